@@ -503,25 +503,34 @@ int AudioClass::Audio(int process, int adc_buffer_size, int dac_buffer_size)
 
     status = CSL_SOK;
 
+    /* Buffers are allocated once at I2S_DMA_BUF_LEN, so later calls only
+       change the transfer lengths. Safe from the DMA ISR; the new lengths
+       are used from the next DMA restart on. */
+    if ((adc_buffer_size > I2S_DMA_BUF_LEN) || (dac_buffer_size > I2S_DMA_BUF_LEN) ||
+        (adc_buffer_size <= 0) || (dac_buffer_size <= 0))
+    {
+        return (CSL_ESYS_FAIL);
+    }
+
     adcBufferSize = adc_buffer_size;
     dacBufferSize = dac_buffer_size;
 
-    i2sDmaLeftBuff1 = new Uint16*[2];
-    i2sDmaRightBuff1 = new Uint16*[2];
-    i2sDmaLeftBuff2 = new Uint16*[2];
-    i2sDmaRightBuff2 = new Uint16*[2];
-    
-    i2sDmaLeftBuff1[0] = new Uint16[adcBufferSize];
-    i2sDmaLeftBuff1[1] = new Uint16[adcBufferSize];
-    i2sDmaRightBuff1[0] = new Uint16[adcBufferSize];
-    i2sDmaRightBuff1[1] = new Uint16[adcBufferSize];
-    i2sDmaLeftBuff2[0] = new Uint16[dacBufferSize];
-    i2sDmaLeftBuff2[1] = new Uint16[dacBufferSize];
-    i2sDmaRightBuff2[0] = new Uint16[dacBufferSize];
-    i2sDmaRightBuff2[1] = new Uint16[dacBufferSize]; 
-    
     if (!this->isInitialized)
     {
+        i2sDmaLeftBuff1 = new Uint16*[2];
+        i2sDmaRightBuff1 = new Uint16*[2];
+        i2sDmaLeftBuff2 = new Uint16*[2];
+        i2sDmaRightBuff2 = new Uint16*[2];
+
+        i2sDmaLeftBuff1[0] = new Uint16[I2S_DMA_BUF_LEN];
+        i2sDmaLeftBuff1[1] = new Uint16[I2S_DMA_BUF_LEN];
+        i2sDmaRightBuff1[0] = new Uint16[I2S_DMA_BUF_LEN];
+        i2sDmaRightBuff1[1] = new Uint16[I2S_DMA_BUF_LEN];
+        i2sDmaLeftBuff2[0] = new Uint16[I2S_DMA_BUF_LEN];
+        i2sDmaLeftBuff2[1] = new Uint16[I2S_DMA_BUF_LEN];
+        i2sDmaRightBuff2[0] = new Uint16[I2S_DMA_BUF_LEN];
+        i2sDmaRightBuff2[1] = new Uint16[I2S_DMA_BUF_LEN];
+
     /* Initialize the DMA transfer buffers */
         if (process == TRUE)
         {
@@ -14,9 +14,35 @@
 //FIR Filtering
 #include "filterFir.h"
 
+//long FIR filters in the frequency domain
+#include "firFft.h"
+
+//FIR filters designed on the device
+#include "firDesign.h"
+
+//IIR filters designed on the device
+#include "iirDesign.h"
+
+//parallel IIR branches run from the same input and summed
+#include "iirParallel.h"
+
+//swept state variable filter, gliding to a cutoff
+#include "iirSweep.h"
+
+//parametric EQ bands after the IIR filters
+#include "iirEq.h"
+
+//narrow FIR filters at a decimated rate
+#include "firMultirate.h"
+
+//adaptive noise canceller in the FIR slot
+#include "firNlms.h"
+
+//coefficient sets streamed over several mailbox frames
+#include "coeffUpload.h"
+
 //Channel mathematical operations
 #include "channelMath.h"
-mathChannelConfig mathChannel;
 
 
 //reverb
@@ -41,25 +67,28 @@ reverbClass reverbR;
 //spectrum analysis
 #include "fftCode.h"
 
-//Sample buffers
+//block ring between the DMA interrupt and the processing worker
+#include "blockRing.h"
 
-  // input samples
-  int filterIn1[I2S_DMA_BUF_LEN];
-  int filterIn2[I2S_DMA_BUF_LEN];
-  
-  // intermeidate processing samples
-  int filterInt1[I2S_DMA_BUF_LEN];
-  int filterInt2[I2S_DMA_BUF_LEN];
-  
-  // output samples
-  int filterOut1[I2S_DMA_BUF_LEN];
-  int filterOut2[I2S_DMA_BUF_LEN];
+//per-stage timing
+#include "stageProfile.h"
+
+//busy time of the audio path against the block period
+#include "cpuLoad.h"
 
-// flag to indicate that input samples are ready to be filtered
-unsigned short readyForFilter = 0;
+//diagnostics records, drained when loop() has nothing else to do
+#include "logRing.h"
 
-//  flag to indicate samples are processed
-unsigned short filterBufAvailable = 0;
+//compiled processing chain
+#include "pipeline.h"
+
+//double-banked stage parameters, handlers write the shadow bank
+#include "paramBank.h"
+
+//IIR coefficient sets already designed
+#include "coeffCache.h"
+
+//Sample buffers
 
 // flag to switch between the data buffers of the Audio library
 unsigned short writeBufIndex = 0;
@@ -74,40 +103,58 @@ inline void setXF(bool togg) //macro to toggle XF LED on DSP Shield
   else
     asm(" BIT(ST1, #13) = #0");
 }
-// DMA Interrupt Service Routine
+
+// Runs the compiled processing chain in place on one block of the ring. Called by
+// the ring worker with interrupts enabled, so DMA interrupts can preempt it.
+void processAudioBlock(audioBlock &block)
+{
+    pipelineRun(audioPipeline, block.left, block.right, block.length);
+}
+
+// DMA Interrupt Service Routine. Only moves blocks between the codec buffers and
+// the ring and restarts DMA; the processing runs in the ring worker afterwards.
 interrupt void dmaIsr(void)
 {
     unsigned short ifrValue;
+    audioBlock *block;
+    loadEnter(micros());
     ifrValue = DMA.getInterruptStatus();
     if ((ifrValue >> DMA_CHAN_ReadR) & 0x01)
     {
-      /* Data read from codec is copied to filter input buffers.
-           Filtering is done after configuring DMA for next block of transfer
-           ensuring no data loss */
-      if(inputCodec == 0)
-      {
-            fillShortBuf(filterIn1, 0, I2S_DMA_BUF_LEN);
-            fillShortBuf(filterIn2, 0, I2S_DMA_BUF_LEN);
-      }
-      else if(inputCodec == 1)
+      loadBlock(micros()); //one read interrupt per block
+      /* The buffer the codec just filled is swapped into a free ring block, the
+         block's old buffer takes its place for the DMA restart after next. */
+      block = blockRingFillSlot(audioRing);
+      if(block)
       {
-        copyShortBuf(AudioC.audioInLeft[AudioC.activeInBuf], filterIn1, I2S_DMA_BUF_LEN);
-        copyShortBuf(AudioC.audioInRight[AudioC.activeInBuf], filterIn2, I2S_DMA_BUF_LEN);
+        if(inputCodec == 0)
+        {
+          fillShortBuf(block->left, 0, I2S_DMA_BUF_LEN);
+          fillShortBuf(block->right, 0, I2S_DMA_BUF_LEN);
+        }
+        else if(inputCodec == 1)
+        {
+          swapBlockBuffer(block->left, AudioC.audioInLeft[AudioC.activeInBuf]);
+          swapBlockBuffer(block->right, AudioC.audioInRight[AudioC.activeInBuf]);
+        }
+        blockRingFilled(audioRing);
       }
-        readyForFilter = 1;
+      blockRingRetimeRead(audioRing); //a new block length starts with the next transfer
     }
     else if ((ifrValue >> DMA_CHAN_WriteR) & 0x01)
     {
-        if (filterBufAvailable)
+        block = blockRingDrainSlot(audioRing);
+        if (block)
         {
-            /* Filtered buffers need to be copied to audio out buffers as
-               audio library is configured for non-loopback mode */
+            /* Processed blocks are swapped into the audio out buffers as
+               audio library is configured for non-loopback mode. isrDma starts
+               the next transfer from writeBufIndex, whose old buffer finished
+               playing a block ago and goes back to the ring. */
             writeBufIndex = (AudioC.activeOutBuf == FALSE)? TRUE: FALSE; //OH GOD, WHY?
-            copyShortBuf(iirL.hpf.dst, AudioC.audioOutLeft[writeBufIndex], I2S_DMA_BUF_LEN);
-            copyShortBuf(iirR.hpf.dst, AudioC.audioOutRight[writeBufIndex], I2S_DMA_BUF_LEN);
-            //copyShortBuf(filterOut1, AudioC.audioOutLeft[writeBufIndex], I2S_DMA_BUF_LEN);
-            //copyShortBuf(filterOut2, AudioC.audioOutRight[writeBufIndex], I2S_DMA_BUF_LEN);
-            filterBufAvailable = 0;
+            swapBlockBuffer(block->left, AudioC.audioOutLeft[writeBufIndex]);
+            swapBlockBuffer(block->right, AudioC.audioOutRight[writeBufIndex]);
+            blockRingRetimeWrite(audioRing, *block);
+            blockRingDrained(audioRing);
         }
     }
 
@@ -116,51 +163,9 @@ interrupt void dmaIsr(void)
      */
     AudioC.isrDma();
 
-    // Check if filter buffers are ready. No filtering required for write interrupt
-    if (readyForFilter)
-    {
-        readyForFilter = 0;
-
-        //DDS Generation
-        ddsGen(ddsConfigLeft, filterIn1, I2S_DMA_BUF_LEN);
-        ddsGen(ddsConfigRight, filterIn2, I2S_DMA_BUF_LEN);
-        
-        noiseGen(noiseConfigLeft, filterIn1, I2S_DMA_BUF_LEN);
-        noiseGen(noiseConfigRight, filterIn2, I2S_DMA_BUF_LEN);
-
-
-        //channel math
-        processMathChannels(mathChannel);
-        
-        //reverb
-        reverbL.processReverb();
-        reverbR.processReverb();
-
-        //IIR Filtering
-        IIRProcessChannel(iirL);
-        IIRProcessChannel(iirR);
-
-        if(FIRTagL) //FIR Filtering
-        {
-          // Filter Left Audio Channel
-          filter_fir(iirL.hpf.dst, FIRcoeffsL, iirL.hpf.dst, delayBufferL, I2S_DMA_BUF_LEN, filterLen);
-          //filter_fir(filterIn1, FIRcoeffsL, filterOut1, delayBufferL, I2S_DMA_BUF_LEN, filterLen);
-        }
-
-        if(FIRTagR) //FIR Filtering
-        {
-          // Filter Right Audio Channel
-          filter_fir(iirR.hpf.dst, FIRcoeffsR, iirR.hpf.dst, delayBufferR, I2S_DMA_BUF_LEN, filterLen);
-          //filter_fir(filterIn2, FIRcoeffsR, filterOut2, delayBufferR, I2S_DMA_BUF_LEN, filterLen);
-        }
-        filterBufAvailable = 1; //send output data on next interrupt
-        
-        //FFT handling
-        updateSpectrumPointer(fftConfigLeft, filterIn1, iirL.hpf.dst, (int **) AudioC.audioInLeft); //pick the left source buffer
-        spectrum(fftConfigLeft); //generate FFT'd spectrum
-        updateSpectrumPointer(fftConfigRight, filterIn2, iirR.hpf.dst, (int **) AudioC.audioInRight); //pick the right source buffer
-        spectrum(fftConfigRight); //generate FFT'd spectrum
-    }
+    //process whatever the ring holds. Returns at once if we preempted the worker.
+    blockRingRunWorker(audioRing, processAudioBlock);
+    loadExit(micros());
 }
 // Initializes OLED and Audio modules 
 void setup()
@@ -186,20 +191,21 @@ void setup()
     disp.flip();    
     disp.setline(0);
     disp.print("Shield App");
+
+    //empty log rings before anything can write to them
+    logInit();
     
     // Clear all the data buffers
-    fillShortBuf(filterIn1, 0, I2S_DMA_BUF_LEN);    
-    fillShortBuf(filterIn2, 0, I2S_DMA_BUF_LEN);
-    fillShortBuf(filterOut1, 0, I2S_DMA_BUF_LEN);
-    fillShortBuf(filterOut2, 0, I2S_DMA_BUF_LEN);
-    fillShortBuf(filterInt1, 0, I2S_DMA_BUF_LEN);    
-    fillShortBuf(filterInt2, 0, I2S_DMA_BUF_LEN);
+    blockRingInit(audioRing, BLOCK_RING_SIZE);
     
+    //time the folded kernels against filter_fir on this device, in the idle delay lines.
+    firSymmetricCalibrate(delayBufferL[0], delayBufferL[1], delayBufferR[0]);
+
     /* Clear the delay buffers, which will be used by the FIR filtering
        algorithm, These buffers need to be initialized to all zeroes in the
        beginning of the FIR filtering algorithm */
-    fillShortBuf(delayBufferL, 0, (FILTER_LENGTH_MAX + 2));       
-    fillShortBuf(delayBufferR, 0, (FILTER_LENGTH_MAX + 2));       
+    fillShortBuf(delayBufferL[0], 0, 2*FIR_DELAY_LEN);       
+    fillShortBuf(delayBufferR[0], 0, 2*FIR_DELAY_LEN);       
     
     /* Audio library is configured for non-loopback mode. Gives enough time for
        FIR filter processing in ISR */
@@ -208,40 +214,90 @@ void setup()
     //initialize SD Card
     status = SD.begin(1);
     status = AudioC.Audio(TRUE);
-    AudioC.setSamplingRate(SAMPLING_RATE_44_KHZ);
+    blockRingSetRate(audioRing, SAMPLING_RATE_44_KHZ);
+    profileInit(audioRing.sampleRate, I2S_DMA_BUF_LEN);
+    loadInit(micros());
+    coeffCacheInit();
     if (status == 0)
     {
         AudioC.attachIntr(dmaIsr);
     }  
     AudioC.setOutputVolume(94);
 
-    //initialize DDS module for both left and right channels
-    ddsConfigInit(ddsConfigLeft);
-    ddsConfigInit(ddsConfigRight);
-
-    //initialize DDS module for both left and right channels
-    noiseConfigInit(noiseConfigLeft);
-    noiseConfigInit(noiseConfigRight);
-    
-    //set up channel math
-    mathChannelInit(filterIn1, filterIn1, filterIn2, filterIn2, mathChannel);
+    //both parameter banks start with DDS, noise, math, IIR and FIR off.
+    //IIR channels are in no filter mode, every mode runs in place on the ring blocks.
+    paramInit(audioParams);
     
-    //initialize reverb channels
-    reverbL.init(0, filterIn1, filterIn1);
-    reverbR.init(0, filterIn2, filterIn2);
+    //initialize reverb channels, the pipeline points them at every block
+    reverbL.init(0, 0, 0);
+    reverbR.init(0, 0, 0);
 
     //Initialize FFT for both channels
     fftConfigLeft = FFTInit();
     fftConfigRight = FFTInit();
-    
-    //set up IIR channels
-    iirL = newIIRChannel(IIRdelayBufferL_L, IIRdelayBufferL_H, IIRcoeffsL_L, IIRcoeffsL_H);
-    iirR = newIIRChannel(IIRdelayBufferR_L, IIRdelayBufferR_H, IIRcoeffsR_L, IIRcoeffsR_H);
-   
-    //configure for no filter mode, indicate the three prebuilt buffers for each channel.
-    configureIIRChannel(iirL,ALL_PASS,filterIn1, filterOut1, filterInt1); 
-    configureIIRChannel(iirR,ALL_PASS,filterIn2, filterOut2, filterInt2);
-    
+
+    //bind every stage to the processing graph, it compiles on the first block.
+    pipelineSources sources;
+    sources.params = &audioParams;
+    sources.reverb[0] = &reverbL;
+    sources.reverb[1] = &reverbR;
+    sources.firDelay[0][0] = delayBufferL[0];
+    sources.firDelay[0][1] = delayBufferL[1];
+    sources.firDelay[1][0] = delayBufferR[0];
+    sources.firDelay[1][1] = delayBufferR[1];
+    sources.firFft[0] = &firFftLeft;
+    sources.firFft[1] = &firFftRight;
+    sources.firMultirate[0][0] = &firMultirateLeft[0];
+    sources.firMultirate[0][1] = &firMultirateLeft[1];
+    sources.firMultirate[1][0] = &firMultirateRight[0];
+    sources.firMultirate[1][1] = &firMultirateRight[1];
+    sources.nlms = &firNlmsLeft;
+    sources.sweep[0] = &iirSweepLeft;
+    sources.sweep[1] = &iirSweepRight;
+    sources.eq[0] = &eqStateLeft;
+    sources.eq[1] = &eqStateRight;
+    sources.fft[0] = &fftConfigLeft;
+    sources.fft[1] = &fftConfigRight;
+    pipelineInit(audioPipeline, sources);
+}
+
+// Raises the dropout alarm configured with command 28 when the ring counts a new fault.
+unsigned int lastRingFaults = 0;
+void ringAlarm()
+{
+  unsigned int faults = blockRingFaults(audioRing);
+  if(faults == lastRingFaults)
+  {
+    return;
+  }
+  lastRingFaults = faults;
+  if(audioRing.alarmMode & RING_ALARM_XF)
+  {
+    setXF(faults != 0); //counters cleared, alarm cleared.
+  }
+  if(audioRing.alarmMode & RING_ALARM_OLED)
+  {
+    char line[20];
+    sprintf(line, "D%u R%u L%u", audioRing.dropped, audioRing.repeated, audioRing.late);
+    disp.setline(0);
+    disp.clear(0);
+    disp.print(line);
+  }
+}
+
+// Shows the load on OLED line 0 when command 33 turned it on, once per load window.
+void loadDisplay()
+{
+  if(!audioLoad.display || !audioLoad.windowReady)
+  {
+    return;
+  }
+  audioLoad.windowReady = 0;
+  char line[20];
+  sprintf(line, "CPU %u%% pk %u%%", audioLoad.average / 10, audioLoad.peak / 10);
+  disp.setline(0);
+  disp.clear(0);
+  disp.print(line);
 }
 
 int heartbeat = 0;
@@ -261,6 +317,14 @@ void loop()
 
   sendSpectrum(fftConfigLeft); //send the spectrum if needed.
   sendSpectrum(fftConfigRight);
+  sendStageProfile(); //send the stage timing if requested.
+  sendRingHealth(); //send the dropout counters if requested.
+  sendCpuLoad(); //send the load figures if requested.
+  sendCoeffCache(); //send the cache counters if requested.
+  sendUploadError(); //answer a refused upload begin.
+  ringAlarm();
+  loadDisplay();
+  logDrain(); //a few log records at most, last so nothing above waits on them.
   delayMicroseconds(10);
 }
 
@@ -275,9 +339,9 @@ void readFilter()
    case 1: //fir load direct, syntax is: <int command><FILTER_LENGTH x int coefficients>
      FIRRecieve(channel);
      break;
-   case 2: //2 = FIR LOW_PASS, 3 = FIR HIGH_PASS, syntax is: <int command><int cutoff>
+   case 2: //2 = FIR LOW_PASS, 3 = FIR HIGH_PASS, syntax is: <int command><int channel><int cutoff><int taps>
    case 3: 
-   case 4: //4 = FIR BANDPASS, 5 = FIR NOTCH, syntax is: <int command><int lower bound><int upper bound>
+   case 4: //4 = FIR BANDPASS, 5 = FIR NOTCH, syntax is: <int command><int channel><int lower bound><int upper bound><int taps>
    case 5:
      FIRLoad(channel, command);
      break;
@@ -302,9 +366,11 @@ void readFilter()
        break;
    case 13: //spectrum initialize
      initializeFFTSpectrum(channel);
+     pipelineInvalidate(); //the spectrum isn't banked, recompile its steps at the next block
      break;
    case 14: //diable spectrum;
      disableFFTSpectrum(channel);
+     pipelineInvalidate();
      break;
    case 15: //enable audio codec input
      inputCodec = 1;
@@ -315,18 +381,21 @@ void readFilter()
    case 17: //OLED Display print
      oledPrintMessage();
      break;
-   case 18: //dual IIR filter transmission.
+   case 18: //dual IIR filter transmission. Mode 5 (PARALLEL_SUM) sums the low pass biquads, each run from the input
      IIRRecieveDual(channel);
      break;
    case 19: //IIR toggle
-      if(iirL.lpf.enabled == 0)
-       iirL.lpf.enabled = 1;
+     {
+      stageParams &params = paramEdit(audioParams);
+      if(params.iir[CHAN_LEFT].lpf.enabled == 0)
+       params.iir[CHAN_LEFT].lpf.enabled = 1;
      else
-       iirL.lpf.enabled = 0;    
-      if(iirR.lpf.enabled == 0)
-       iirR.lpf.enabled = 1;
+       params.iir[CHAN_LEFT].lpf.enabled = 0;    
+      if(params.iir[CHAN_RIGHT].lpf.enabled == 0)
+       params.iir[CHAN_RIGHT].lpf.enabled = 1;
      else
-       iirR.lpf.enabled = 0;    
+       params.iir[CHAN_RIGHT].lpf.enabled = 0;    
+     }
      break;
    case 20: //output volume control.
       AudioC.setOutputVolume((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]);
@@ -335,16 +404,24 @@ void readFilter()
       AudioC.setInputGain((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4],(shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]);
      break;
    case 22: // channel math operations
-      mathChannelMode(mathChannel, channel, (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]);
+      mathChannelMode(paramEdit(audioParams).math, channel, (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]);
       break;
-   case 23: //reverb
-     if((channel == CHAN_LEFT) || (channel == CHAN_BOTH))
-     {
-       reverbL.setReverbDelay((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]);
-     }
-     if((channel == CHAN_RIGHT) || (channel == CHAN_BOTH))
+   case 23: //reverb, the pipeline resizes the delay when the bank goes live
      {
-       reverbR.setReverbDelay((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]);
+       stageParams &params = paramEdit(audioParams);
+       int delaySamps = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+       if(delaySamps > MAX_DELAY)
+       {
+         delaySamps = MAX_DELAY;
+       }
+       if((channel == CHAN_LEFT) || (channel == CHAN_BOTH))
+       {
+         params.reverbDelay[CHAN_LEFT] = delaySamps;
+       }
+       if((channel == CHAN_RIGHT) || (channel == CHAN_BOTH))
+       {
+         params.reverbDelay[CHAN_RIGHT] = delaySamps;
+       }
      }
      break;
    case 24: //noise start
@@ -353,7 +430,86 @@ void readFilter()
    case 25: //noise stop
      noiseStop(channel);
      break;
+   case 26: //stage timing readback, syntax is: <int command><int channel><int reset after read>
+     profileRequest();
+     break;
+   case 27: //dropout counters readback, syntax is: <int command><int channel><int reset after read>
+     ringHealthRequest();
+     break;
+   case 28: //dropout alarm, syntax is: <int command><int channel><int mode>, mode bit 0 = XF LED, bit 1 = OLED
+     ringAlarmConfig();
+     break;
+   case 29: //stage order, syntax is: <int command><int channel><int count><count x int stage>, stages 0..6 = dds, noise, math, reverb, iir, fir, spectrum
+     pipelineOrderCommand();
+     break;
+   case 30: //block length, syntax is: <int command><int channel><int samples>, samples = 64, 128, 256 or 512
+     {
+       int oldLength = audioRing.length;
+       if(blockRingSetLength(audioRing, (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]))
+       {
+         ddsBlockLength(oldLength, audioRing.length);
+         profileInit(audioRing.sampleRate, audioRing.length); //histogram slices follow the block period
+       }
+     }
+     break;
+   case 31: //sampling rate, syntax is: <int command><int channel><long rate>, low word first, 8000 to 192000 Hz
+     sampleRateCommand();
+     break;
+   case 32: //CPU load readback, syntax is: <int command><int channel><int reset after read>
+     loadRequest();
+     break;
+   case 33: //CPU load on OLED line 0, syntax is: <int command><int channel><int on>
+     loadDisplayConfig();
+     break;
+   case 34: //FIR crossover, syntax is: <int command><int channel><int taps>, longer filters run in the FFT engine
+     firFftCrossoverCommand();
+     pipelineInvalidate(); //the FIR kernels are picked when the graph compiles
+     break;
+   case 35: //long FIR from the SD card, syntax is: <int command><int channel><int taps><file name>
+     FIRLoadFile(channel);
+     break;
+   case 36: //IIR design cache readback, syntax is: <int command><int channel><int mode>, 1 = clear counters after read, 2 = also empty the cache
+     coeffCacheRequest();
+     break;
+   case 37: //FIR design, syntax is: <int command><int channel><int type><int taps><int f1><int f2><int window>, types as commands 2..5 less one, window 0 = Blackman, else Kaiser beta in tenths
+     FIRDesign(channel);
+     break;
+   case 38: //multirate FIR, syntax is: <int command><int channel><int type><int taps><int f1><int f2><int window><int factor>, as 37 at the rate divided by factor (2, 4 or 8), low and band pass only
+     FIRMultirate(channel);
+     break;
+   case 39: //adaptive noise canceller, syntax is: <int command><int channel><int taps>, left is the primary and right the noise reference, 0 taps = off. Restarts the taps from zero
+     firNlmsModeCommand();
+     break;
+   case 40: //canceller step size, syntax is: <int command><int channel><int mu>, Q15, normalised to the reference power
+     firNlmsStepCommand();
+     break;
+   case 41: //canceller leak, syntax is: <int command><int channel><int leak>, Q15 fraction the taps shrink by every block
+     firNlmsLeakCommand();
+     break;
+   case 42: //canceller freeze, syntax is: <int command><int channel><int frozen>, 1 holds the taps, 0 adapts again
+     firNlmsFreezeCommand();
+     break;
+   case 43: //coefficient upload begin, syntax is: <int command><int channel><int target><int words><int order low><int order high><int mode>, target 0 = FIR of words taps, 1 = IIR low pass, 2 = IIR high pass, 3 = both with mode as command 18
+     uploadBeginCommand(channel);
+     break;
+   case 44: //coefficient upload chunk, syntax is: <int command><int channel><int offset><coefficients>, offset in words, in order
+     uploadChunkCommand();
+     break;
+   case 45: //coefficient upload end, syntax is: <int command><int channel><int apply>, 1 binds the set if it arrived whole, 0 drops it
+     uploadEndCommand();
+     break;
+   case 46: //EQ band, syntax is: <int command><int channel><int band><int type><int hz><int q><int gain>, band 0..9, type 0 = peak, 1 = low shelf, 2 = high shelf, 3 = notch, q in hundredths, gain in signed tenths of a dB. Turns the band on
+     eqBandCommand(channel);
+     break;
+   case 47: //EQ band enable, syntax is: <int command><int channel><int band><int on>, an off band keeps its settings and costs nothing
+     eqEnableCommand(channel);
+     break;
+   case 48: //IIR sweep, syntax is: <int command><int channel><int pass><int hz><int q><int ms>, pass as command 18's mode up to 4 (band pass at unity peak), 0 = off, q in hundredths. Glides from where the filter is, the first sweep or 0 ms jumps
+     iirSweepCommand(channel);
+     break;
    }
+  paramCommit(audioParams); //the worker flips to whatever the handler wrote at the next block and recompiles then, readbacks open nothing
+
   //friendly messaged recieve LED toggle.
   if(ledBlink)
   {
@@ -365,6 +521,31 @@ void readFilter()
   }
   digitalWrite(LED0, ledBlink);
 }
+// Switches the codec rate and carries every rate dependent setting over, so tones keep
+// their pitch, chirps and spectra their timing and reverbs their delay time.
+// Filter coefficients are not redesigned, they keep their normalized frequencies; EQ bands and the sweep are.
+void sampleRateCommand()
+{
+   long rate = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
+   rate <<= 16;
+   rate += (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+   long oldRate = audioRing.sampleRate;
+   if((rate == oldRate) || !blockRingSetRate(audioRing, rate))
+   {
+     return;
+   }
+   ddsSampleRate(oldRate, rate);
+   fftSampleRate();
+   stageParams &params = paramEdit(audioParams);
+   for(int ch = 0; ch < 2; ch++)
+   {
+     eqSampleRate(params.eq[ch], rate); //the EQ bands and the sweep are set in Hz, unlike the uploaded filters
+     iirSweepSampleRate(params.sweep[ch], rate);
+     long delaySamps = params.reverbDelay[ch] * rate / oldRate;
+     params.reverbDelay[ch] = (delaySamps > MAX_DELAY) ? MAX_DELAY : delaySamps;
+   }
+   profileInit(audioRing.sampleRate, audioRing.length); //the block period changed
+}
 void oledPrintMessage()
 {
    disp.setline(1);
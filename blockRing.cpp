@@ -0,0 +1,254 @@
+#include "blockRing.h"
+#include "logRing.h"
+
+blockRing audioRing;
+
+void blockRingInit(blockRing &ring, int depth)
+{
+  if(depth > BLOCK_RING_SIZE)
+  {
+    depth = BLOCK_RING_SIZE;
+  }
+  if(depth < 2)
+  {
+    depth = 2;
+  }
+  ring.depth = depth;
+  ring.length = I2S_DMA_BUF_LEN;
+  ring.readLength = I2S_DMA_BUF_LEN;
+  ring.writeLength = I2S_DMA_BUF_LEN;
+  ring.sampleRate = SAMPLING_RATE_44_KHZ;
+  ring.filled = 0;
+  ring.processed = 0;
+  ring.drained = 0;
+  ring.fillIndex = 0;
+  ring.processIndex = 0;
+  ring.drainIndex = 0;
+  ring.workerBusy = 0;
+  ring.primed = 0;
+  ring.alarmMode = 0;
+  ring.sendRequested = 0;
+  ring.resetRequests = 0;
+  ring.resetsDone = 0;
+  ring.lateResets = 0;
+  blockRingResetHealth(ring);
+  for(int i = 0; i < BLOCK_RING_SIZE; i++) //call once, before the DMA starts trading buffers
+  {
+    ring.blocks[i].left = ring.store[2*i];
+    ring.blocks[i].right = ring.store[2*i + 1];
+    memset(ring.blocks[i].left, 0, I2S_DMA_BUF_LEN);
+    memset(ring.blocks[i].right, 0, I2S_DMA_BUF_LEN);
+    ring.blocks[i].length = I2S_DMA_BUF_LEN;
+  }
+}
+
+audioBlock* blockRingFillSlot(blockRing &ring)
+{
+  unsigned short requests = ring.resetRequests;
+  if(requests != ring.resetsDone) //a block boundary, the write interrupt can't run until this one returns
+  {
+    unsigned int late = ring.late;
+    blockRingResetHealth(ring);
+    ring.late = late; //the worker's to clear
+    ring.resetsDone = requests;
+  }
+  if((unsigned short)(ring.filled - ring.drained) >= ring.depth) //every block is queued or waiting for the codec
+  {
+    ring.dropped++;
+    int args[1] = {(int) ring.dropped};
+    logWarn(LOG_EVENT_RING_DROP, args, 1);
+    return 0;
+  }
+  return &ring.blocks[ring.fillIndex];
+}
+
+void blockRingFilled(blockRing &ring)
+{
+  ring.blocks[ring.fillIndex].length = ring.readLength;
+  ring.fillRepeated[ring.fillIndex] = ring.repeated;
+  ring.fillIndex = (ring.fillIndex + 1) % ring.depth;
+  ring.filled++;
+}
+
+audioBlock* blockRingProcessSlot(blockRing &ring)
+{
+  if(ring.filled == ring.processed)
+  {
+    return 0;
+  }
+  return &ring.blocks[ring.processIndex];
+}
+
+void blockRingProcessed(blockRing &ring)
+{
+  unsigned short resets = ring.resetsDone;
+  int ranDry = ring.fillRepeated[ring.processIndex] != (unsigned short) ring.repeated; //the output ran dry while this block waited
+  if(resets != ring.lateResets)
+  {
+    ring.late = 0;
+    ring.lateResets = resets;
+  }
+  if(ranDry && (resets == ring.resetsDone)) //a reset between the two reads would make any block look late
+  {
+    ring.late++;
+  }
+  ring.processIndex = (ring.processIndex + 1) % ring.depth;
+  ring.processed++;
+  ring.primed = 1;
+}
+
+audioBlock* blockRingDrainSlot(blockRing &ring)
+{
+  unsigned int queued = (unsigned short)(ring.processed - ring.drained);
+  if(!ring.primed) //nothing has come through the worker yet, not a dropout
+  {
+    return 0;
+  }
+  if(queued < ring.minQueued)
+  {
+    ring.minQueued = queued;
+  }
+  if(queued == 0)
+  {
+    ring.repeated++;
+    return 0;
+  }
+  return &ring.blocks[ring.drainIndex];
+}
+
+void blockRingDrained(blockRing &ring)
+{
+  ring.drainIndex = (ring.drainIndex + 1) % ring.depth;
+  ring.drained++;
+}
+
+void blockRingRunWorker(blockRing &ring, void (*process)(audioBlock &block))
+{
+  if(ring.workerBusy) //we preempted the worker, it will pick up the new block itself.
+  {
+    return;
+  }
+  ring.workerBusy = 1;
+  audioBlock *block;
+  while(1)
+  {
+    enableNestedInterrupts();
+    while((block = blockRingProcessSlot(ring)) != 0)
+    {
+      process(*block);
+      blockRingProcessed(ring);
+    }
+    disableNestedInterrupts();
+    if(blockRingProcessSlot(ring) == 0) //recheck with interrupts off, a block may have landed after the last look.
+    {
+      break;
+    }
+  }
+  ring.workerBusy = 0;
+}
+
+int blockRingSetLength(blockRing &ring, int length)
+{
+  if((length < BLOCK_LEN_MIN) || (length > I2S_DMA_BUF_LEN) || (length & (length - 1)))
+  {
+    return 0;
+  }
+  ring.length = length;
+  return 1;
+}
+
+void blockRingRetimeRead(blockRing &ring)
+{
+  int length = ring.length;
+  if(length != ring.readLength) //blocks already in the ring keep the length they were captured at
+  {
+    ring.readLength = length;
+    AudioC.Audio(TRUE, ring.readLength, ring.writeLength);
+  }
+}
+
+void blockRingRetimeWrite(blockRing &ring, audioBlock &block)
+{
+  if(block.length != ring.writeLength)
+  {
+    ring.writeLength = block.length;
+    AudioC.Audio(TRUE, ring.readLength, ring.writeLength);
+  }
+}
+
+int blockRingSetRate(blockRing &ring, long rate)
+{
+  //SAMPLING_RATE_ADC_16_KHZ_DAC_48_KHZ is left out, every stage assumes one rate.
+  if((rate != SAMPLING_RATE_8_KHZ) && (rate != SAMPLING_RATE_11_KHZ) && (rate != SAMPLING_RATE_12_KHZ) &&
+     (rate != SAMPLING_RATE_16_KHZ) && (rate != SAMPLING_RATE_22_KHZ) && (rate != SAMPLING_RATE_24_KHZ) &&
+     (rate != SAMPLING_RATE_32_KHZ) && (rate != SAMPLING_RATE_44_KHZ) && (rate != SAMPLING_RATE_48_KHZ) &&
+     (rate != SAMPLING_RATE_96_KHZ) && (rate != SAMPLING_RATE_192_KHZ))
+  {
+    return 0;
+  }
+  if(AudioC.setSamplingRate(rate) != CSL_SOK)
+  {
+    return 0;
+  }
+  ring.sampleRate = rate;
+  return 1;
+}
+
+void blockRingResetHealth(blockRing &ring)
+{
+  ring.dropped = 0;
+  ring.repeated = 0;
+  ring.late = 0;
+  ring.minQueued = 0xFFFF;
+  for(int i = 0; i < BLOCK_RING_SIZE; i++)
+  {
+    ring.fillRepeated[i] = 0;
+  }
+}
+
+void blockRingRequestReset(blockRing &ring)
+{
+  ring.resetRequests = ring.resetRequests + 1;
+}
+
+unsigned int blockRingFaults(blockRing &ring)
+{
+  return ring.dropped + ring.repeated + ring.late;
+}
+
+void ringHealthRequest()
+{
+  audioRing.sendRequested = 1;
+  if(((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]) == 1) //reset after reading
+  {
+    audioRing.sendRequested = 2;
+  }
+}
+
+void ringAlarmConfig()
+{
+  audioRing.alarmMode = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+}
+
+void sendRingHealth()
+{
+  if(audioRing.sendRequested == 0)
+  {
+    return;
+  }
+  //<blocks filled><RING_HEALTH_TAG><dropped><repeated><late><min queued><ring depth>
+  int message[7];
+  message[0] = audioRing.filled;
+  message[1] = RING_HEALTH_TAG;
+  message[2] = audioRing.dropped;
+  message[3] = audioRing.repeated;
+  message[4] = audioRing.late;
+  message[5] = audioRing.minQueued;
+  message[6] = audioRing.depth;
+  shieldMailbox.transmit(message, 7);
+  if(audioRing.sendRequested == 2)
+  {
+    blockRingRequestReset(audioRing);
+  }
+  audioRing.sendRequested = 0;
+}
@@ -0,0 +1,98 @@
+//Ring of audio blocks between the DMA interrupt and the processing worker.
+//The read interrupt fills blocks, the worker processes them and the write
+//interrupt drains them to the codec. With three blocks a heavy block (FFT frame
+//plus long FIR) can borrow the slack left by a light one.
+//Blocks hold no samples of their own: the interrupts swap buffer pointers with
+//the AudioClass ping-pong arrays, so nothing is copied on the way through.
+//isrDma re-reads audioInLeft/audioOutLeft[] every time it restarts the DMA.
+#ifndef _BLOCKRING_H_INCLUDED	//prevent ring library from being invoked twice and breaking the namespace
+#define _BLOCKRING_H_INCLUDED
+
+#include "Audio_exposed.h"
+#include "mailbox.h"
+
+#define BLOCK_RING_SIZE 3
+#define BLOCK_LEN_MIN 64 //shortest block, the longest is I2S_DMA_BUF_LEN
+#define RING_HEALTH_TAG (-512) //second word of a ring health message
+
+#define RING_ALARM_XF 1 //light the XF LED on a dropout
+#define RING_ALARM_OLED 2 //print dropout counts on OLED line 0
+
+//ST1 bit 11 is INTM. Clearing it inside the ISR lets the next DMA interrupt
+//preempt the worker so buffer swaps and DMA restarts are never held off.
+#define enableNestedInterrupts() asm(" BIT(ST1, #11) = #0")
+#define disableNestedInterrupts() asm(" BIT(ST1, #11) = #1")
+
+struct audioBlock {
+  int* left;
+  int* right;
+  int length; //samples the read DMA captured into this block
+};
+
+//trade a block buffer for a DMA buffer the codec is done with.
+inline void swapBlockBuffer(int* &samples, Uint16* &dmaBuffer)
+{
+  Uint16* spare = (Uint16*) samples;
+  samples = (int*) dmaBuffer;
+  dmaBuffer = spare;
+}
+
+struct blockRing {
+  audioBlock blocks[BLOCK_RING_SIZE];
+  int store[2*BLOCK_RING_SIZE][I2S_DMA_BUF_LEN]; //initial block buffers, they wander off into the DMA arrays
+  int depth; //blocks in use, 2 gives classic double buffering
+  volatile int length; //requested block length, the read interrupt switches to it
+  int readLength; //length the read DMA is set up for
+  int writeLength; //length the write DMA is set up for
+  long sampleRate; //codec rate, both directions run at it
+  //running counts, each one written by a single context so no locking is needed.
+  volatile unsigned short filled; //read interrupt
+  volatile unsigned short processed; //worker
+  volatile unsigned short drained; //write interrupt
+  unsigned short fillIndex;
+  unsigned short processIndex;
+  unsigned short drainIndex;
+  volatile int workerBusy;
+  volatile int primed; //set by the worker once the first block is through, output is silent before that
+  //health counters, again one writer each.
+  volatile unsigned int dropped; //read interrupt found every block busy, input lost
+  volatile unsigned int repeated; //write interrupt found nothing processed, codec replays stale data
+  volatile unsigned int late; //worker finished a block after the output already ran dry
+  volatile unsigned int minQueued; //fewest processed blocks waiting at a write interrupt, 0xFFFF until measured
+  unsigned short fillRepeated[BLOCK_RING_SIZE]; //repeat count when each block was filled
+  //a reset is asked for by loop() and carried out by the writers at their next block.
+  volatile unsigned short resetRequests; //loop()
+  volatile unsigned short resetsDone; //read interrupt, it clears all but late
+  unsigned short lateResets; //worker, resetsDone when it last cleared late
+  int alarmMode; //RING_ALARM_ bits
+  int sendRequested;
+};
+
+void blockRingInit(blockRing &ring, int depth); //empties the ring, depth is clamped to 2..BLOCK_RING_SIZE
+
+audioBlock* blockRingFillSlot(blockRing &ring); //block for the read interrupt to fill, 0 (and a drop is counted) if the ring is full. Once per interrupt.
+void blockRingFilled(blockRing &ring); //hand the filled block to the worker
+
+audioBlock* blockRingProcessSlot(blockRing &ring); //next block waiting for the worker, 0 if none
+void blockRingProcessed(blockRing &ring); //hand the processed block to the write interrupt
+
+audioBlock* blockRingDrainSlot(blockRing &ring); //next processed block for the codec, 0 (and a repeat is counted) if none is ready. Once per interrupt.
+void blockRingDrained(blockRing &ring); //release the block for refilling
+
+void blockRingRunWorker(blockRing &ring, void (*process)(audioBlock &block)); //call from the ISR tail, processes every pending block with interrupts enabled
+
+int blockRingSetLength(blockRing &ring, int length); //request a new block length, 0 unless a power of two from BLOCK_LEN_MIN to I2S_DMA_BUF_LEN
+void blockRingRetimeRead(blockRing &ring); //read interrupt, after the fill: the next read transfer takes the requested length
+void blockRingRetimeWrite(blockRing &ring, audioBlock &block); //write interrupt, after the drain: the next write transfer plays the block at its own length
+int blockRingSetRate(blockRing &ring, long rate); //reprogram the codec, 0 unless it has a table for the rate
+
+void blockRingResetHealth(blockRing &ring); //clears the health counters, only while no interrupt is writing them
+void blockRingRequestReset(blockRing &ring); //loop() side, the interrupts and the worker clear the counters at their next block
+unsigned int blockRingFaults(blockRing &ring); //dropped + repeated + late, for spotting new faults
+void ringHealthRequest(); //mailbox command, queues a readback for loop()
+void ringAlarmConfig(); //mailbox command, sets the RING_ALARM_ bits
+void sendRingHealth(); //sends the health counters if requested. Call from loop()
+
+extern blockRing audioRing;
+
+#endif
@@ -29,34 +29,34 @@ void mathChannelMode(mathChannelConfig &config, int channel, int mode)
   }
 }
 
-void processMathChannels(mathChannelConfig &config)
+void processMathChannels(mathChannelConfig &config, int frameSize)
 {
   if((config.modeL != MATH_NONE) && (config.modeR == config.modeL)) //both nonzero and the same
   {
-    processMathChannel(config.inL, config.inR, config.outL, config.modeL);
-    memcpy(config.outR, config.outL, I2S_DMA_BUF_LEN); //normal, just copy one block in.
+    processMathChannel(config.inL, config.inR, config.outL, config.modeL, frameSize);
+    memcpy(config.outR, config.outL, frameSize); //normal, just copy one block in.
   }
   else //evaluate each one separately.
   {
     if(config.modeL != MATH_NONE)
     {
-      processMathChannel(config.inL, config.inR, config.outL, config.modeL);
+      processMathChannel(config.inL, config.inR, config.outL, config.modeL, frameSize);
     }
     if(config.modeR != MATH_NONE)
     {
-      processMathChannel(config.inR, config.inL, config.outR, config.modeR);
+      processMathChannel(config.inR, config.inL, config.outR, config.modeR, frameSize);
     }
   }
 }
 
-void processMathChannel(int* src1, int* src2, int* dst, int mode)
+void processMathChannel(int* src1, int* src2, int* dst, int mode, int frameSize)
 {
   if(mode == MATH_SUB)
   {
-    sub((DATA *) src1, (DATA *) src2, (DATA *) dst, I2S_DMA_BUF_LEN, 0); 
+    sub((DATA *) src1, (DATA *) src2, (DATA *) dst, frameSize, 0); 
   }
   else if(mode == MATH_ADD)
   {
-    add((DATA *) src1, (DATA *) src2, (DATA *) dst, I2S_DMA_BUF_LEN, 0); 
+    add((DATA *) src1, (DATA *) src2, (DATA *) dst, frameSize, 0); 
   }
 }
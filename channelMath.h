@@ -18,8 +18,8 @@ void mathChannelInit(int* inL, int* outL, int* inR, int* outR, mathChannelConfig
 
 void mathChannelMode(mathChannelConfig &config, int channel, int mode);
 
-void processMathChannels(mathChannelConfig &config);
+void processMathChannels(mathChannelConfig &config, int frameSize);
 
-void processMathChannel(int* src1, int* src2, int* dst, int mode);
+void processMathChannel(int* src1, int* src2, int* dst, int mode, int frameSize);
 
 #endif
@@ -0,0 +1,140 @@
+#include "coeffCache.h"
+
+coeffCache iirDesignCache;
+
+void coeffCacheInit()
+{
+  for(int i = 0; i < COEFF_CACHE_SLOTS; i++)
+  {
+    iirDesignCache.slots[i].lastUse = 0;
+  }
+  iirDesignCache.useCount = 0;
+  iirDesignCache.hits = 0;
+  iirDesignCache.misses = 0;
+  iirDesignCache.evictions = 0;
+  iirDesignCache.sendRequested = 0;
+}
+
+coeffKey coeffKeyMake(int type, int pass, int length, int cutoff, long rate)
+{
+  coeffKey key;
+  key.type = type;
+  key.pass = pass;
+  key.length = length;
+  key.cutoff = cutoff;
+  key.rate = rate;
+  return key;
+}
+
+int keysMatch(const coeffKey &a, const coeffKey &b)
+{
+  return (a.type == b.type) && (a.pass == b.pass) && (a.length == b.length) && (a.cutoff == b.cutoff) && (a.rate == b.rate);
+}
+
+//marks a slot most recently used. The stamps are renumbered when the counter would wrap.
+void touchSlot(coeffSlot &slot)
+{
+  if(iirDesignCache.useCount == 0xFFFF)
+  {
+    for(int i = 0; i < COEFF_CACHE_SLOTS; i++)
+    {
+      if(iirDesignCache.slots[i].lastUse)
+      {
+        iirDesignCache.slots[i].lastUse = 1 + iirDesignCache.slots[i].lastUse / 0x2000; //keeps the order, roughly
+      }
+    }
+    iirDesignCache.useCount = 1 + 0xFFFF / 0x2000;
+  }
+  slot.lastUse = ++iirDesignCache.useCount;
+}
+
+int coeffCacheGet(const coeffKey &key, int* target, int words)
+{
+  for(int i = 0; i < COEFF_CACHE_SLOTS; i++)
+  {
+    coeffSlot &slot = iirDesignCache.slots[i];
+    if(slot.lastUse && keysMatch(slot.key, key))
+    {
+      memcpy(target, slot.coeffs, words);
+      touchSlot(slot);
+      iirDesignCache.hits++;
+      return 1;
+    }
+  }
+  iirDesignCache.misses++;
+  return 0;
+}
+
+void coeffCachePut(const coeffKey &key, const int* coeffs, int words)
+{
+  if(words > COEFF_CACHE_WORDS)
+  {
+    return;
+  }
+  coeffSlot *victim = &iirDesignCache.slots[0];
+  for(int i = 0; i < COEFF_CACHE_SLOTS; i++) //an empty slot, or else the least recently used one
+  {
+    coeffSlot &slot = iirDesignCache.slots[i];
+    if(slot.lastUse < victim->lastUse)
+    {
+      victim = &slot;
+    }
+  }
+  if(victim->lastUse)
+  {
+    iirDesignCache.evictions++;
+  }
+  victim->key = key;
+  memcpy(victim->coeffs, coeffs, words);
+  touchSlot(*victim);
+}
+
+void coeffCacheRequest()
+{
+  int mode = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  iirDesignCache.sendRequested = 1;
+  if(mode == COEFF_CACHE_RESET)
+  {
+    iirDesignCache.sendRequested = 2;
+  }
+  else if(mode == COEFF_CACHE_FLUSH)
+  {
+    iirDesignCache.sendRequested = 3;
+  }
+}
+
+void sendCoeffCache()
+{
+  if(iirDesignCache.sendRequested == 0)
+  {
+    return;
+  }
+  //<hits><COEFF_CACHE_TAG><misses><evictions><sets held><COEFF_CACHE_SLOTS>
+  int held = 0;
+  for(int i = 0; i < COEFF_CACHE_SLOTS; i++)
+  {
+    if(iirDesignCache.slots[i].lastUse)
+    {
+      held++;
+    }
+  }
+  int message[6];
+  message[0] = iirDesignCache.hits;
+  message[1] = COEFF_CACHE_TAG;
+  message[2] = iirDesignCache.misses;
+  message[3] = iirDesignCache.evictions;
+  message[4] = held;
+  message[5] = COEFF_CACHE_SLOTS;
+  shieldMailbox.transmit(message, 6);
+  if(iirDesignCache.sendRequested == 3)
+  {
+    coeffCacheInit();
+  }
+  else if(iirDesignCache.sendRequested == 2)
+  {
+    iirDesignCache.hits = 0;
+    iirDesignCache.misses = 0;
+    iirDesignCache.evictions = 0;
+  }
+  iirDesignCache.sendRequested = 0;
+}
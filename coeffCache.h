@@ -0,0 +1,54 @@
+//RAM cache of IIR coefficient sets designed on the device.
+//loadfilterIIR looks a set up by response, pass, order, cutoff and sampling
+//rate before running iirDesign, and stores every set it did have to design.
+//A retune the host has made before takes a copy instead of a float design,
+//which on the fixed point core is the slow part of a retune.
+//When the cache is full the least recently used set makes room.
+#ifndef _COEFFCACHE_H_INCLUDED	//prevent cache library from being invoked twice and breaking the namespace
+#define _COEFFCACHE_H_INCLUDED
+
+#include "core.h"
+#include "mailbox.h"
+#include "filterIir.h"
+
+#define COEFF_CACHE_SLOTS 8
+#define COEFF_CACHE_WORDS (COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2) //longest set
+#define COEFF_CACHE_TAG (-768) //second word of a cache statistics message
+
+#define COEFF_CACHE_RESET 1 //readback mode: clear the counters after reading
+#define COEFF_CACHE_FLUSH 2 //readback mode: also drop every set
+
+struct coeffKey {
+  int type; //response, TYPE_BUTTER, TYPE_BESSEL, TYPE_ELLIP or TYPE_CHEBY
+  int pass; //LOW_PASS or HIGH_PASS
+  int length; //order
+  int cutoff; //Hz
+  long rate; //sampling rate the set was designed at
+};
+
+struct coeffSlot {
+  coeffKey key;
+  int coeffs[COEFF_CACHE_WORDS];
+  unsigned int lastUse; //0 marks an empty slot
+};
+
+struct coeffCache {
+  coeffSlot slots[COEFF_CACHE_SLOTS];
+  unsigned int useCount; //stamps lastUse
+  unsigned int hits;
+  unsigned int misses;
+  unsigned int evictions;
+  int sendRequested;
+};
+
+void coeffCacheInit(); //empties the cache and clears the counters
+coeffKey coeffKeyMake(int type, int pass, int length, int cutoff, long rate);
+int coeffCacheGet(const coeffKey &key, int* target, int words); //1 and the set copied to target on a hit
+void coeffCachePut(const coeffKey &key, const int* coeffs, int words); //keeps a set just designed
+
+void coeffCacheRequest(); //mailbox command, queues a readback for loop()
+void sendCoeffCache(); //sends the counters if requested. Call from loop()
+
+extern coeffCache iirDesignCache; //the IIR sets loadfilterIIR designed
+
+#endif
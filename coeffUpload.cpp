@@ -0,0 +1,254 @@
+#include "coeffUpload.h"
+#include "firSymmetric.h"
+
+coeffUpload audioUpload;
+
+int uploadRefuse(coeffUpload &up, int target, int error)
+{
+  up.error = error;
+  up.errorTarget = target;
+  return 0;
+}
+
+int uploadBegin(int target, int channel, unsigned int words, int orderLow, int orderHigh, int mode)
+{
+  coeffUpload &up = audioUpload;
+  unsigned int lowWords = 0;
+  if(up.active) //the host ends it first, with apply 0 if it gave up
+  {
+    return uploadRefuse(up, target, UPLOAD_ERROR_BUSY);
+  }
+  if(target == UPLOAD_FIR)
+  {
+    if((words == 0) || (words > FIR_FFT_TAPS_MAX))
+    {
+      return uploadRefuse(up, target, UPLOAD_ERROR_INVALID);
+    }
+  }
+  else if((target >= UPLOAD_IIR_LOW) && (target <= UPLOAD_IIR_DUAL))
+  {
+    int low = (target == UPLOAD_IIR_HIGH) ? 0 : orderLow;
+    int high = (target == UPLOAD_IIR_LOW) ? 0 : orderHigh;
+    if((low < 0) || (high < 0) || (low > IIR_ORDER_MAX) || (high > IIR_ORDER_MAX) || (low % 2) || (high % 2))
+    {
+      return uploadRefuse(up, target, UPLOAD_ERROR_INVALID);
+    }
+    lowWords = low/2*COEFFS_PER_BIQUAD;
+    words = lowWords + high/2*COEFFS_PER_BIQUAD;
+    if(target == UPLOAD_IIR_LOW)
+    {
+      orderHigh = -1;
+      mode = LOW_PASS;
+    }
+    else if(target == UPLOAD_IIR_HIGH)
+    {
+      orderLow = -1;
+      mode = HIGH_PASS;
+    }
+  }
+  else
+  {
+    return uploadRefuse(up, target, UPLOAD_ERROR_INVALID);
+  }
+  up.params = &paramEdit(audioParams);
+  paramHold(audioParams);
+  up.active = 1;
+  up.failed = 0;
+  up.target = target;
+  up.channel = channel;
+  up.words = words;
+  up.received = 0;
+  up.lowWords = lowWords;
+  up.orderLow = orderLow;
+  up.orderHigh = orderHigh;
+  up.mode = mode;
+  if(target == UPLOAD_FIR)
+  {
+    up.setOf[CHAN_LEFT] = up.params->firSetOf[CHAN_LEFT];
+    up.setOf[CHAN_RIGHT] = up.params->firSetOf[CHAN_RIGHT];
+    up.set = &firSetAcquire(*up.params, channel);
+    up.set->fft.parts = (words + FIR_FFT_PART - 1) / FIR_FFT_PART;
+  }
+  else
+  {
+    if(orderLow >= 0)
+    {
+      iirLink(*up.params, channel, 0);
+    }
+    if(orderHigh >= 0)
+    {
+      iirLink(*up.params, channel, 1);
+    }
+  }
+  return 1;
+}
+
+//one coefficient, in the bank's own storage.
+void uploadStore(coeffUpload &up, unsigned int position, int value)
+{
+  if(up.target == UPLOAD_FIR)
+  {
+    if(up.words <= FILTER_LENGTH_MAX) //longer filters only run in the FFT engine
+    {
+      up.set->coeffs[position] = value;
+    }
+    up.part[position % FIR_FFT_PART] = value;
+    if(position % FIR_FFT_PART == FIR_FFT_PART - 1)
+    {
+      firFftDesignPart(up.set->fft, position / FIR_FFT_PART, up.part, FIR_FFT_PART);
+    }
+    return;
+  }
+  iirChannel &iir = up.params->iir[(up.channel == CHAN_RIGHT) ? CHAN_RIGHT : CHAN_LEFT]; //a CHAN_BOTH set is linked, the right channel runs the left one's
+  if(position < up.lowWords)
+  {
+    iir.lpf.coeffs[position] = value;
+  }
+  else
+  {
+    iir.hpf.coeffs[position - up.lowWords] = value;
+  }
+}
+
+void uploadWords(unsigned int offset, const unsigned char* bytes, unsigned int count)
+{
+  coeffUpload &up = audioUpload;
+  if(!up.active || up.failed)
+  {
+    return;
+  }
+  if((offset > up.received) || (offset + count > up.words)) //a chunk went missing, or the host lost count
+  {
+    up.failed = 1;
+    return;
+  }
+  for(unsigned int i = up.received - offset; i < count; i++) //the part already in place came in a retried chunk
+  {
+    int value = (short)((bytes[2*i+1]<<8) + bytes[2*i]); //a no-op on the C55x, sign extends where an int is wider
+    uploadStore(up, offset + i, value);
+  }
+  if(offset + count > up.received)
+  {
+    up.received = offset + count;
+  }
+}
+
+//a dropped upload's sets back as they were, the rest of the shadow bank is left alone.
+void uploadUndo(coeffUpload &up)
+{
+  stageParams &params = *up.params;
+  //the live bank has the sets as they run; an edit to them still waiting for a flip is lost.
+  stageParams &live = paramLive(audioParams);
+  if(up.target == UPLOAD_FIR) //the channels go back to their sets, and the one it took to what it held
+  {
+    for(int ch = CHAN_LEFT; ch <= CHAN_RIGHT; ch++)
+    {
+      params.fir[params.firSetOf[ch]].refs--;
+      params.firSetOf[ch] = up.setOf[ch];
+      params.fir[up.setOf[ch]].refs++;
+    }
+    int taken = up.set - params.fir;
+    int refs = params.fir[taken].refs;
+    params.fir[taken] = live.fir[taken];
+    params.fir[taken].refs = refs;
+    return;
+  }
+  for(int set = 0; set < 2; set++)
+  {
+    if(((set == 0) ? up.orderLow : up.orderHigh) >= 0) //unlinking copied into the right channel too
+    {
+      memcpy(params.iirCoeffs[CHAN_LEFT][set], live.iirCoeffs[CHAN_LEFT][set], COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2);
+      memcpy(params.iirCoeffs[CHAN_RIGHT][set], live.iirCoeffs[CHAN_RIGHT][set], COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2);
+      params.iirLinked[set] = live.iirLinked[set];
+    }
+  }
+  bindBankCoeffs(params);
+}
+
+int uploadEnd(int apply)
+{
+  coeffUpload &up = audioUpload;
+  if(!up.active)
+  {
+    return 0;
+  }
+  up.active = 0;
+  if(!apply || up.failed || (up.received != up.words))
+  {
+    uploadUndo(up);
+    paramRelease(audioParams, 1); //other commands' edits share the bank
+    return 0;
+  }
+  stageParams &params = *up.params;
+  if(up.target == UPLOAD_FIR)
+  {
+    firSet &set = *up.set;
+    int last = up.words % FIR_FFT_PART;
+    if(last)
+    {
+      firFftDesignPart(set.fft, up.words / FIR_FFT_PART, up.part, last);
+    }
+    set.length = up.words;
+    set.symmetric = (up.words <= FILTER_LENGTH_MAX) && firIsSymmetric(set.coeffs, up.words);
+    set.factor = 1;
+    firBind(params, up.channel);
+  }
+  else
+  {
+    for(int ch = CHAN_LEFT; ch <= CHAN_RIGHT; ch++)
+    {
+      if((up.channel == ch) || (up.channel == CHAN_BOTH))
+      {
+        iirChannel &iir = params.iir[ch];
+        if(up.orderLow >= 0)
+        {
+          iir.lpf.order = up.orderLow;
+        }
+        if(up.orderHigh >= 0)
+        {
+          iir.hpf.order = up.orderHigh;
+        }
+        setIIRChannelMode(iir, up.mode); //configure blocks
+      }
+    }
+  }
+  paramRelease(audioParams, 1);
+  return 1;
+}
+
+void uploadBeginCommand(int channel)
+{
+  int target = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  unsigned int words = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
+  int orderLow = (shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8];
+  int orderHigh = (shieldMailbox.inbox[11]<<8) + shieldMailbox.inbox[10];
+  int mode = (shieldMailbox.inbox[13]<<8) + shieldMailbox.inbox[12];
+  uploadBegin(target, channel, words, orderLow, orderHigh, mode);
+}
+
+void uploadChunkCommand()
+{
+  unsigned int offset = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  uploadWords(offset, shieldMailbox.inbox + 6, (shieldMailbox.inboxSize - 6) / 2);
+}
+
+void uploadEndCommand()
+{
+  uploadEnd((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]);
+}
+
+void sendUploadError()
+{
+  if(audioUpload.error == 0)
+  {
+    return;
+  }
+  //<target><UPLOAD_TAG><UPLOAD_ERROR_><target of the unfinished upload, -1 if none>
+  int message[4];
+  message[0] = audioUpload.errorTarget;
+  message[1] = UPLOAD_TAG;
+  message[2] = audioUpload.error;
+  message[3] = audioUpload.active ? audioUpload.target : -1;
+  shieldMailbox.transmit(message, 4);
+  audioUpload.error = 0;
+}
@@ -0,0 +1,60 @@
+//Streamed coefficient upload, for sets longer than a mailbox frame.
+//A begin command opens the shadow parameter bank and holds it, so the worker
+//keeps running the live bank and readFilter's commits wait. Chunks carry their
+//word offset and are decoded from the mailbox bytes straight into the set they
+//belong to, the FIR partition spectra are computed as each partition fills.
+//The end command binds the set and commits the bank, or drops it. Nothing is
+//allocated, the only buffer is one FIR partition.
+//Chunks must arrive in order; one repeated after a retry is skipped, a gap
+//fails the upload and its end drops it. A dropped upload puts back the sets
+//it wrote, from the live bank, and other commands sent during it still go
+//live. A begin while an upload is unfinished, or one that can't be taken, is
+//refused with an error reply sent from loop(); an end with apply 0 gives up.
+//FIRRecieve, IIRRecieve and IIRRecieveDual are a begin, one chunk and an end.
+#ifndef _COEFFUPLOAD_H_INCLUDED	//prevent upload library from being invoked twice and breaking the namespace
+#define _COEFFUPLOAD_H_INCLUDED
+
+#include "core.h"
+#include "mailbox.h"
+#include "paramBank.h"
+
+#define UPLOAD_FIR 0 //words are taps, up to FIR_FFT_TAPS_MAX
+#define UPLOAD_IIR_LOW 1 //low pass biquads, IIRRecieve's LOW_PASS
+#define UPLOAD_IIR_HIGH 2 //high pass biquads, IIRRecieve's HIGH_PASS
+#define UPLOAD_IIR_DUAL 3 //low pass then high pass biquads, IIRRecieveDual
+#define UPLOAD_TAG (-1024) //second word of an upload error reply
+
+#define UPLOAD_ERROR_BUSY 1 //another upload is unfinished
+#define UPLOAD_ERROR_INVALID 2 //no such target, or the set doesn't fit
+
+struct coeffUpload {
+  int active;
+  int failed; //a chunk left a gap, or didn't fit
+  int target; //UPLOAD_
+  int channel;
+  unsigned int words; //the set's length
+  unsigned int received; //words in place, the next chunk starts here
+  unsigned int lowWords; //of an IIR set, the low pass part comes first
+  int orderLow; //-1 leaves the order alone
+  int orderHigh;
+  int mode; //IIR channel mode at the end
+  stageParams* params; //the held shadow bank
+  firSet* set;
+  int setOf[2]; //the FIR sets the channels ran before the upload took one
+  int error; //UPLOAD_ERROR_ of the last refused begin, sent by sendUploadError
+  int errorTarget;
+  int part[FIR_FFT_PART]; //the FIR partition being received
+};
+
+int uploadBegin(int target, int channel, unsigned int words, int orderLow, int orderHigh, int mode); //0 if the set can't be taken or an upload is unfinished, with an error reply queued
+void uploadWords(unsigned int offset, const unsigned char* bytes, unsigned int count); //count little endian words from the mailbox
+int uploadEnd(int apply); //binds the set if apply and every word arrived, returns 1 if it did
+
+void uploadBeginCommand(int channel); //<int command><int channel><int target><int words><int order low><int order high><int mode>
+void uploadChunkCommand(); //<int command><int channel><int offset><coefficients>
+void uploadEndCommand(); //<int command><int channel><int apply>
+void sendUploadError(); //sends the reply to a refused begin, if there is one. Call from loop()
+
+extern coeffUpload audioUpload;
+
+#endif
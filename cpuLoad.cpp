@@ -0,0 +1,126 @@
+#include "cpuLoad.h"
+
+cpuLoad audioLoad;
+
+void loadReset()
+{
+  audioLoad.current = 0;
+  audioLoad.average = 0;
+  audioLoad.peak = 0;
+  audioLoad.max = 0;
+  audioLoad.windowSum = 0;
+  audioLoad.windowPeak = 0;
+  audioLoad.windowCount = 0;
+  audioLoad.windowReady = 0;
+}
+
+void loadInit(unsigned long now)
+{
+  audioLoad.busy = 0;
+  audioLoad.busyStart = now;
+  audioLoad.blockStart = now;
+  audioLoad.nesting = 0;
+  audioLoad.display = 0;
+  audioLoad.sendRequested = 0;
+  loadReset();
+}
+
+void loadEnter(unsigned long now)
+{
+  if(audioLoad.nesting++ == 0)
+  {
+    audioLoad.busyStart = now;
+  }
+}
+
+void loadExit(unsigned long now)
+{
+  if(--audioLoad.nesting == 0)
+  {
+    audioLoad.busy += now - audioLoad.busyStart;
+  }
+}
+
+void loadBlock(unsigned long now)
+{
+  //the interrupt in progress is split at the block boundary.
+  if(audioLoad.nesting)
+  {
+    audioLoad.busy += now - audioLoad.busyStart;
+    audioLoad.busyStart = now;
+  }
+  unsigned long busy = audioLoad.busy;
+  unsigned long elapsed = now - audioLoad.blockStart;
+  audioLoad.busy = 0;
+  audioLoad.blockStart = now;
+  if(elapsed == 0)
+  {
+    return;
+  }
+  while(elapsed > 0x3FFFFF) //keep busy*LOAD_FULL in 32 bits after a stall
+  {
+    elapsed >>= 1;
+    busy >>= 1;
+  }
+  unsigned int load = LOAD_FULL;
+  if(busy < elapsed)
+  {
+    load = (busy * LOAD_FULL) / elapsed;
+  }
+
+  audioLoad.current = load;
+  if(load > audioLoad.max)
+  {
+    audioLoad.max = load;
+  }
+  if(load > audioLoad.windowPeak)
+  {
+    audioLoad.windowPeak = load;
+  }
+  audioLoad.windowSum += load;
+  if(++audioLoad.windowCount == LOAD_WINDOW)
+  {
+    audioLoad.average = audioLoad.windowSum / LOAD_WINDOW;
+    audioLoad.peak = audioLoad.windowPeak;
+    audioLoad.windowSum = 0;
+    audioLoad.windowPeak = 0;
+    audioLoad.windowCount = 0;
+    audioLoad.windowReady = 1;
+  }
+}
+
+void loadRequest()
+{
+  audioLoad.sendRequested = 1;
+  if(((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]) == 1) //reset after reading
+  {
+    audioLoad.sendRequested = 2;
+  }
+}
+
+void loadDisplayConfig()
+{
+  audioLoad.display = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+}
+
+void sendCpuLoad()
+{
+  if(audioLoad.sendRequested == 0)
+  {
+    return;
+  }
+  //<last block><LOAD_TAG><window average><window peak><max since reset><LOAD_WINDOW>, loads in tenths of a percent
+  int message[6];
+  message[0] = audioLoad.current;
+  message[1] = LOAD_TAG;
+  message[2] = audioLoad.average;
+  message[3] = audioLoad.peak;
+  message[4] = audioLoad.max;
+  message[5] = LOAD_WINDOW;
+  shieldMailbox.transmit(message, 6);
+  if(audioLoad.sendRequested == 2)
+  {
+    loadReset();
+  }
+  audioLoad.sendRequested = 0;
+}
@@ -0,0 +1,46 @@
+//CPU load of the audio path.
+//dmaIsr stamps its entry and exit with micros(). Only the outermost interrupt
+//counts, so the worker and any transfer interrupts nested into it are charged
+//once. At every read interrupt the busy time is divided by the time since the
+//previous one, which is the block period as the codec actually runs it. What
+//is left over is what loop() and the mailbox get.
+#ifndef _CPULOAD_H_INCLUDED	//prevent load library from being invoked twice and breaking the namespace
+#define _CPULOAD_H_INCLUDED
+
+#include "core.h"
+#include "mailbox.h"
+
+#define LOAD_WINDOW 32 //blocks the average and peak are taken over
+#define LOAD_TAG (-640) //second word of a load message
+#define LOAD_FULL 1000 //loads are in tenths of a percent
+
+struct cpuLoad {
+  unsigned long busy; //microseconds in the audio path since the last block
+  unsigned long busyStart; //entry of the outermost interrupt in progress
+  unsigned long blockStart;
+  int nesting;
+  unsigned int current; //last block
+  unsigned int average; //over the last full window
+  unsigned int peak; //over the last full window
+  unsigned int max; //since the last reset
+  unsigned long windowSum;
+  unsigned int windowPeak;
+  int windowCount;
+  volatile int windowReady; //a new average and peak are out, for the display
+  int display; //show the load on OLED line 0
+  int sendRequested;
+};
+
+void loadInit(unsigned long now); //clears the figures, the first block is timed from now
+void loadReset(); //clears the figures, keeps the timing and display setting
+void loadEnter(unsigned long now); //interrupt entry, with interrupts disabled
+void loadExit(unsigned long now); //interrupt exit, with interrupts disabled
+void loadBlock(unsigned long now); //once per block, from the read interrupt
+
+void loadRequest(); //mailbox command, queues a readback for loop()
+void loadDisplayConfig(); //mailbox command, turns the OLED display on or off
+void sendCpuLoad(); //sends the load figures if requested. Call from loop()
+
+extern cpuLoad audioLoad;
+
+#endif
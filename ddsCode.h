@@ -1,6 +1,5 @@
 //dds variables and buffers.
 //OH GOD so many globals. Such variable creep. Build a struct!
-//#define AUDIO_INTERRUPTION 1 //causes audio to be interrupted on SD card hit.
 #ifndef _DDS_H_INCLUDED	//prevent mailbox library from being invoked twice and breaking the namespace
 #define _DDS_H_INCLUDED
 
@@ -54,8 +53,10 @@ ddsConfig ddsInit(int command, float fStart, float fEnd, float gain, int chirpLo
 void ddsChirpStart(int channel, int command);
 void ddsToneStart(int channel, int command);
 void ddsStop(int channel);
+void ddsBlockLength(int oldLength, int newLength); //keeps running chirps at their sweep time when the block length changes
+void ddsSampleRate(long oldRate, long newRate); //keeps tones at their pitch and chirps at their sweep time across a rate change
+void ddsHandover(ddsConfig &next, const ddsConfig &running); //carries a running generator into a newly committed bank
 
 extern int phase_to_amplitude_l[DDS_LENGTH];
 extern int phase_to_amplitude_r[DDS_LENGTH];
-extern ddsConfig ddsConfigLeft, ddsConfigRight;
 #endif
@@ -1,4 +1,5 @@
 #include "fftCode.h"
+#include "blockRing.h"
 
 #pragma DATA_ALIGN(WINDOW_LENGTH) //I2S_DMA_BUF_LEN
 int fftBufferL[WINDOW_LENGTH] = {0};
@@ -28,6 +29,7 @@ fftConfig FFTInit() //returns a new FFTConfig
 	config.count = 0;
 	config.bufferReady = 0;
 	config.updateRate = 0;
+	config.updateSamples = 2*I2S_DMA_BUF_LEN;
 	config.source = 0;
 	config.channel = 0;
         config.length = I2S_DMA_BUF_LEN;
@@ -35,6 +37,15 @@ fftConfig FFTInit() //returns a new FFTConfig
         config.windowType = WINDOW_BLACKMAN;
 	return config;
 }
+//samples between two frames at the current codec rate, at least two full blocks.
+unsigned long updateInterval(int updateRate)
+{
+        unsigned long samples = (float) updateRate * audioRing.sampleRate / 1000;
+        if(samples < 2*I2S_DMA_BUF_LEN)
+          samples = 2*I2S_DMA_BUF_LEN;
+        return samples;
+}
+
 fftConfig configFFT(int enable, int updateRate, int source, int channel, int complex, int windowType, int length) //configures an FFTConfig
 {
 	fftConfig config;
@@ -42,9 +53,8 @@ fftConfig configFFT(int enable, int updateRate, int source, int channel, int com
 	config.enable = enable;
 	config.count = 0;
 	config.bufferReady = 0;
-	config.updateRate = updateRate / 11.6;
-        if(config.updateRate < 2)
-          config.updateRate = 2;
+	config.updateRate = updateRate;
+        config.updateSamples = updateInterval(updateRate);
 	config.source = source;
 	config.channel = channel;
         config.length = length;
@@ -63,7 +73,7 @@ fftConfig configFFT(int enable, int updateRate, int source, int channel, int com
         loadWindow(config);
     return config;
 }
-void updateSpectrumPointer(fftConfig &config, int* in, int* out, int ** codec)
+void updateSpectrumPointer(fftConfig &config, int* in, int* out, int* codec, int frameSize)
 {
 	if(config.enable == 0) //skip if system is disables.
 	{
@@ -71,10 +81,10 @@ void updateSpectrumPointer(fftConfig &config, int* in, int* out, int ** codec)
 	}
 
 	//update source ponter on each run.
-	int* sourceLoc;
+	int* sourceLoc = codec; //an unknown source reads the codec
 	if(config.source == SOURCE_CODEC)
 	{
-		sourceLoc = codec[AudioC.activeInBuf];
+		sourceLoc = codec;
 	}
 	else if(config.source == SOURCE_INPUT)
 	{
@@ -85,16 +95,16 @@ void updateSpectrumPointer(fftConfig &config, int* in, int* out, int ** codec)
 		sourceLoc = out;
 	}
                 
-        if(config.length > I2S_DMA_BUF_LEN) //special case for multi-frame.
+        if(config.length > frameSize) //special case for multi-frame.
         {
-          memmove(config.buffer, config.buffer+I2S_DMA_BUF_LEN, config.length-I2S_DMA_BUF_LEN); //shift array left by one block
-          memcpy(config.buffer+config.length-I2S_DMA_BUF_LEN, sourceLoc, I2S_DMA_BUF_LEN); //copy new block in at end.
+          memmove(config.buffer, config.buffer+frameSize, config.length-frameSize); //shift array left by one block
+          memcpy(config.buffer+config.length-frameSize, sourceLoc, frameSize); //copy new block in at end.
         }
         else
         {
           //if ((config.count >= config.updateRate) && (config.bufferReady == 0))//send ever 100ms
           //{
-            memcpy(config.buffer, sourceLoc, I2S_DMA_BUF_LEN); //normal, just copy one block in.
+            memcpy(config.buffer, sourceLoc, frameSize); //normal, just copy one block in.
           //}
         }
 
@@ -110,11 +120,11 @@ void psd(DATA* source, DATA* dest, int length) // computes magnitude of a vector
       //dest[i/2] = sqrt(source[i]*source[i] + source[i+1]*source[i+1]);
   }
 }
-void spectrum(fftConfig &config) //takes a signal and returns the power spectrum;
+void spectrum(fftConfig &config, int frameSize) //takes a signal and returns the power spectrum;
 {
 	if(config.enable) //only generate spectrum if system is enabled
 	{
-            if ((config.count >= config.updateRate) && (config.bufferReady == 0))//send ever 100ms
+            if ((config.count >= config.updateSamples) && (config.bufferReady == 0))//send ever 100ms
 	    {
                 if(1)//config.length < I2S_DMA_BUF_LEN)
                 {
@@ -137,7 +147,7 @@ void spectrum(fftConfig &config) //takes a signal and returns the power spectrum
 	    }
 	    else
 	    {
-	    	config.count++;
+	    	config.count += frameSize;
 	    }
 	}
 }
@@ -187,9 +197,6 @@ void loadWindow(fftConfig &config) //load the appropriate window into the approp
     
     sprintf(fileName, "win/%s%d.win",windowType,config.length); //default file name
 
-   #ifdef AUDIO_INTERRUPTION
-     AudioC.detachIntr(); //turning off the audio fixes audio / sd card collision
-   #endif
    fileHandle = SD.open(fileName, FILE_READ);
    if(fileHandle)
    {
@@ -207,14 +214,12 @@ void loadWindow(fftConfig &config) //load the appropriate window into the approp
 //   {
 //       asm(" BIT(ST1, #13) = #1"); //flag that we had an incident and try to recover from it.
 //   }
-   #ifdef AUDIO_INTERRUPTION
-     bool status = AudioC.Audio(TRUE);
-     AudioC.setSamplingRate(SAMPLING_RATE_44_KHZ);
-     if (status == 0)
-     {
-       AudioC.attachIntr(dmaIsr);
-     }
-   #endif
+}
+
+void fftSampleRate()
+{
+   fftConfigLeft.updateSamples = updateInterval(fftConfigLeft.updateRate);
+   fftConfigRight.updateSamples = updateInterval(fftConfigRight.updateRate);
 }
 
 void initializeFFTSpectrum(int channel)
@@ -264,4 +269,4 @@ void disableFFTSpectrum(int channel)
      fftConfigLeft.enable = 0;
      fftConfigRight.enable = 0;
    }
-}
+}
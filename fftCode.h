@@ -34,9 +34,10 @@
 
 struct fftConfig { //spectrum variables
 	int enable;
-	int count;
+	unsigned long count; //samples since the last frame
 	int bufferReady;
-	int updateRate;
+	int updateRate; //requested interval in ms
+	unsigned long updateSamples; //the interval at the current rate
 	int source;
 	int channel;
 	int length;
@@ -51,10 +52,11 @@ struct fftConfig { //spectrum variables
 void windowSignal(int * source, int * destination, int *window, int length); //windows a signal.
 fftConfig FFTInit(); //returns a new FFTConfig
 fftConfig configFFT(int enable, int updateRate, int source, int channel, int complex, int windowType, int length); //configures an FFTConfig
-void updateSpectrumPointer(fftConfig &config, int* in, int* out, int ** codec); //if the current mode is SOURCE_CODEC
-void spectrum(fftConfig &config); //takes a signal and returns the power spectrum;
+void updateSpectrumPointer(fftConfig &config, int* in, int* out, int* codec, int frameSize); //codec holds the raw codec samples of the block being processed
+void spectrum(fftConfig &config, int frameSize); //takes a signal and returns the power spectrum;
 void sendSpectrum(fftConfig &config); //sends the current spectrum for the given configuration
 void loadWindow(fftConfig &config);
+void fftSampleRate(); //recompute the update intervals of both spectra after a rate change
 void initializeFFTSpectrum(int channel);
 void disableFFTSpectrum(int channel);
 
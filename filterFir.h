@@ -1,10 +1,14 @@
 #include "mailbox.h"
+#include "paramBank.h"
+#include "firSymmetric.h"
+#include "firDesign.h"
+#include "blockRing.h"
+#include "coeffUpload.h"
+#include "logRing.h"
 
 // Length of the Coefficient Vector
-//#define AUDIO_INTERRUPTION 1 //causes audio to be interrupted on SD card hit.
 #define FILTER_LENGTH_DEFAULT (201)
 #define FILTER_LENGTH_MAX (511)
-#define FILE_CHUNK (100)
 
 //general defines
 #define CHAN_LEFT 0
@@ -16,257 +20,192 @@
 #define BAND_PASS 3
 #define BAND_STOP 4
 
-unsigned int filterLen = FILTER_LENGTH_DEFAULT;
-//fir buffers
-volatile int FIRTagL = 0;
-volatile int FIRTagR = 0;
-// FIR Filter coefficients with 201 taps
-int FIRcoeffsL[FILTER_LENGTH_MAX] = {0};
-int FIRcoeffsR[FILTER_LENGTH_MAX] = {0};
-// Delay buffer used by the FIR filtering algorithm for Left Channel
-int delayBufferL[FILTER_LENGTH_MAX + 2];
-// Delay buffer used by the FIR filtering algorithm for Right Channel
-int delayBufferR[FILTER_LENGTH_MAX + 2];
-
-extern interrupt void dmaIsr(void);
-
-void loadfilter(char* ftype, char *fpass, int Hz, int* target, int targetLength)
-{
-    File          fileHandle;
-    //int newCoeffs[FILTER_LENGTH_MAX] = {0};
-    
-    long shortHz = Hz;
-    shortHz -= 10; //lowest cutoff frequency = 10Hz
-    int fileBin = shortHz / FILE_CHUNK; //alias to 1000Hz files.
-    shortHz %= FILE_CHUNK; //alias to 1000Hz bins.
-    shortHz *= targetLength; //201 tap long filters;
-    shortHz *= 2; // 2 bytes per tap;
-    char fileName[32];
-    sprintf(fileName, "%s/%d/%s/%d.flt",ftype,targetLength,fpass,fileBin); //default file name
-    
-//    for(int i = 0; i<3; i++)
-//    {
-//      fileName[i] = ftype[i];
-//      fileName[i+4] = fpass[i];
-//    }
-//    fileName[0] = ftype[0];
-//    fileName[4] = fpass[0];
-      
-//    Serial.begin(115200);    
-//    Serial.print("Freq: ");
-//    Serial.println(Hz);
-//    Serial.print("Taps: ");
-//    Serial.println(targetLength);
-//    Serial.println(fileName);
-//    Serial.end();
-
-    //if (TRUE == status)
-    if(1)
-     {
-       #ifdef AUDIO_INTERRUPTION
-       AudioC.detachIntr(); //turning off the audio fixes audio / sd card collision
-       #endif
-       fileHandle = SD.open(fileName, FILE_READ);
-        if(fileHandle)
-        {
-
-          fileHandle.seek(shortHz);
-//        for(int i = 0; i < targetLength; i++)
-//        {
-//          int coeff;
-//          fileHandle.read((char*) &coeff, 1);
-//          int coeff2;
-//          fileHandle.read((char*) &coeff2, 1);
-//          coeff = (coeff2<<8) + coeff;
-//          target[i] = coeff;
-//        }
-         fileHandle.read(target, targetLength); //load the data
-         fileHandle.close();
-        
-          for(int i = 0; i < targetLength; i++) //fix endian-ness of dataset.
-         {
-           int temp = target[i];
-           target[i] = ((temp & 0x00FF)<<8) + ((temp & 0xFF00)>>8);
-         }          
-         //memcpy(target, newCoeffs, targetLength);
-        }
-//        else
-//        {
-////          Serial.begin(115200);    
-////          Serial.println("File Open Failed");
-////          Serial.end();
-//        }
-       #ifdef AUDIO_INTERRUPTION
-       bool status = AudioC.Audio(TRUE);
-       AudioC.setSamplingRate(SAMPLING_RATE_44_KHZ);
-       if (status == 0)
-       {
-         AudioC.attachIntr(dmaIsr);
-       }
-       #endif
-
-//   else //failed file load LED Flag.
-//   {
-//       asm(" BIT(ST1, #13) = #1"); //flag that we had an incident and try to recover from it.
-//   }
-     }
-}
+//fir buffers, the coefficients and length are banked in paramBank.h
+// Delay buffers used by the FIR filtering algorithm for Left Channel, a pair: on a retune
+// the incoming filter warms up in the idle one while the outgoing one finishes its block
+#pragma DATA_ALIGN(2) //firs wants its delay line on a 32 bit boundary
+int delayBufferL[2][FIR_DELAY_LEN];
+// Delay buffers used by the FIR filtering algorithm for Right Channel
+#pragma DATA_ALIGN(2)
+int delayBufferR[2][FIR_DELAY_LEN];
+// Taps of a design or a file on their way into the shadow bank, mailbox handlers only
+int firDesignTaps[FIR_FFT_TAPS_MAX];
 
 void firDisable(int channel)
 {
+     stageParams &params = paramEdit(audioParams);
        if(channel == CHAN_LEFT)
      {
-       FIRTagL = 0;
+       params.firEnable[CHAN_LEFT] = 0;
      }
      else if(channel == CHAN_RIGHT)
      {
-       FIRTagR = 0;       
+       params.firEnable[CHAN_RIGHT] = 0;       
      }
      else if(channel == CHAN_BOTH)
      {
-       FIRTagL = 0;
-       FIRTagR = 0;
+       params.firEnable[CHAN_LEFT] = 0;
+       params.firEnable[CHAN_RIGHT] = 0;
      }
 }
 
-void FIRRecieve(int channel)
+//copies a finished filter into the shadow bank for the selected channel(s), with
+//its partition spectra so the pipeline can pick either engine. Linked channels
+//share one set, and each channel keeps its own length.
+void firStore(stageParams &params, int channel, int* coeffs, unsigned int length)
 {
-     int* newData = (int*) malloc(shieldMailbox.inboxSize/2);  
-     //Working read via serial code
-     for(int i = 4; i < shieldMailbox.inboxSize; i = i + 2)
+     firSet &set = firSetAcquire(params, channel);
+     set.length = length;
+     set.symmetric = 0;
+     if(length <= FILTER_LENGTH_MAX) //longer filters only run in the FFT engine
      {
-       newData[i/2 - 2] = ((shieldMailbox.inbox[i+1]<<8) + shieldMailbox.inbox[i]);
-     }     
+       memcpy(set.coeffs, coeffs, length);
+       set.symmetric = firIsSymmetric(coeffs, length);
+     }
+     set.factor = 1;
+     firFftDesign(set.fft, coeffs, length);
+     firBind(params, channel);
+}
 
-     int filterLenNew = shieldMailbox.inboxSize/2 - 2; //command and channel take up 4 words the rest are taps.
-     if(filterLenNew > 511) //max out at 511 taps, the absolute most we dare handle.
+//stores a filter designed at the rate divided by factor, for the multirate kernel.
+void firStoreMultirate(stageParams &params, int channel, int* coeffs, unsigned int length, int factor)
+{
+     firSet &set = firSetAcquire(params, channel);
+     memcpy(set.coeffs, coeffs, length);
+     set.length = length;
+     set.symmetric = firIsSymmetric(coeffs, length);
+     set.factor = factor;
+     firMultirateDesign(set.aa, factor);
+     set.fft.parts = 0; //the FFT engine never runs it
+     firBind(params, channel);
+}
+
+//the taps are decoded straight into the shadow bank, as a one chunk upload.
+//Longer sets go through the upload commands, 43 to 45.
+void FIRRecieve(int channel)
+{
+     unsigned int taps = shieldMailbox.inboxSize/2 - 2; //command and channel take up 2 words the rest are taps.
+     if(taps > FIR_FFT_TAPS_MAX) //past FILTER_LENGTH_MAX the FFT engine takes over
      {
-       filterLenNew = 511;
+       taps = FIR_FFT_TAPS_MAX;
      }
-
-     if (channel == CHAN_LEFT) //channel 0 == left
+     if(uploadBegin(UPLOAD_FIR, channel, taps, 0, 0, 0))
      {
-       memcpy(FIRcoeffsL, newData, filterLen);
-       FIRTagL = 1;
+       uploadWords(0, shieldMailbox.inbox + 4, taps);
+       uploadEnd(1);
      }
-     else if (channel == CHAN_RIGHT) //channel 1 == right
+}
+//loads a long filter, up to FIR_FFT_TAPS_MAX taps, from a file of raw taps in the
+//byte order of the SD tables. The whole file is read, a partition at a time, and
+//closed before the shadow bank is opened, so a bad file leaves the bank alone.
+void FIRLoadFile(int channel)
+{
+     //syntax is: <int command><int channel><int taps><file name>
+     unsigned int taps = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+     if(taps > FIR_FFT_TAPS_MAX)
      {
-       memcpy(FIRcoeffsR, newData, filterLen);
-       FIRTagR = 1;
+       taps = FIR_FFT_TAPS_MAX;
      }
-     else if (channel == CHAN_BOTH) //channel 2 == both
+     File fileHandle = SD.open((char*) shieldMailbox.inbox + 6, FILE_READ);
+     if(!fileHandle)
      {
-       memcpy(FIRcoeffsL, newData, filterLen);
-       memcpy(FIRcoeffsR, newData, filterLen);       
-       FIRTagL = 1;
-       FIRTagR = 1;
+       return;
      }
-
-     free(newData);
+     for(unsigned int start = 0; start < taps; start += FIR_FFT_PART)
+     {
+       int count = ((taps - start) > FIR_FFT_PART) ? FIR_FFT_PART : (taps - start);
+       if(fileHandle.read(firDesignTaps + start, count) < count) //shorter than the taps it was sent with
+       {
+         taps = 0;
+         break;
+       }
+     }
+     fileHandle.close();
+     if(taps == 0)
+     {
+       return;
+     }
+     for(unsigned int i = 0; i < taps; i++) //fix endian-ness of dataset.
+     {
+       int temp = firDesignTaps[i];
+       firDesignTaps[i] = ((temp & 0x00FF)<<8) + ((temp & 0xFF00)>>8);
+     }
+     stageParams &params = paramEdit(audioParams);
+     firStore(params, channel, firDesignTaps, taps);
+}
+//designs a filter on the device and stores it for the selected channel(s).
+//Odd lengths up to FIR_FFT_TAPS_MAX are accepted, anything else gets FILTER_LENGTH_DEFAULT.
+void firDesignStore(int channel, int type, unsigned int taps, long f1, long f2, int window)
+{
+     if((taps < 3) || (taps > FIR_FFT_TAPS_MAX) || !(taps & 1))
+     {
+       taps = FILTER_LENGTH_DEFAULT;
+     }
+     if(!firDesign(firDesignTaps, taps, type, f1, f2, audioRing.sampleRate, window))
+     {
+       int args[6] = {type, (int) taps, (int) f1, (int) f2, window, 1};
+       logWarn(LOG_EVENT_FIR_REFUSED, args, 6);
+       return;
+     }
+     stageParams &params = paramEdit(audioParams);
+     firStore(params, channel, firDesignTaps, taps);
 }
+
+//the fixed filter commands, designed with a Blackman window.
 void FIRLoad(int channel, int command)
 {
-     //get Fc
-     char fType[4] = "fir";
-     char fPass[4] = "lpf";  
-     int fCutoff, fQuality, sumMode, type;
-     
-     if(command == 2 || command == 3)
+     //2 = low pass, 3 = high pass: <int cutoff><int taps>
+     //4 = band pass, 5 = band stop: <int lower bound><int upper bound><int taps>
+     unsigned int f1 = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+     unsigned int f2 = f1;
+     unsigned int taps;
+     if(command >= 4)
      {
-     
-       fCutoff = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
-  
-       fQuality = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6]; //quality indicator for filter load.
-       
-       //note, we do this check for sanitization.
-       if((fQuality == 41) || (fQuality == 101) || (fQuality == 201) || (fQuality == 301) || (fQuality == 401) || (fQuality == 511)) //only pass qualities that are on the SD card
-       {
-          filterLen = fQuality;
-       }
-       else
-       {
-          filterLen = 201; //default to medium quality filter
-       }
-  
-       if(command == 3) //hpf
-       {
-         fPass[0] = 'h';  // HIGH_PASS, not LOW_PASS
-       }
-       //High or low pass
-       int* newData = (int*) malloc(filterLen);  
-       loadfilter(fType, fPass, fCutoff, newData, filterLen);
-       if (channel == CHAN_LEFT) //channel 0 == left
-       {
-         memcpy(FIRcoeffsL, newData, filterLen);
-         FIRTagL = 1;
-       }
-       else if (channel == CHAN_RIGHT) //channel 1 == right
-       {
-         memcpy(FIRcoeffsR, newData, filterLen);
-         FIRTagR = 1;       
-       }
-       else if (channel == CHAN_BOTH) //channel 2 == both
-       {
-         memcpy(FIRcoeffsL, newData, filterLen);
-         memcpy(FIRcoeffsR, newData, filterLen);       
-         FIRTagL = 1;
-         FIRTagR = 1;       
-       }
-       free(newData);
+       f2 = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
+       taps = (shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8];
      }
-     else if(command == 4 || command == 5)
+     else
      {
-       filterLen = FILTER_LENGTH_DEFAULT;
-       //BAND FILTER
-       int fCutoff2 = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]; //lpf
-       int fCutoff1 = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6]; //hpf
-  
-       fQuality = (shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8]; //quality indicator for filter load.
-       
-       //note, we do this check for sanitization.
-       if((fQuality == 41) || (fQuality == 101) || (fQuality == 201) || (fQuality == 301) || (fQuality == 401) || (fQuality == 511)) //only pass qualities that are on the SD card
-       {
-          filterLen = fQuality;
-       }
-       else
-       {
-          filterLen = 201; //default to medium quality filter
-       }
-  
-       int coeffs1[2*FILTER_LENGTH_MAX-1] = {0};
-       int coeffs2[FILTER_LENGTH_MAX] = {0};   
-  
-  
-       loadfilter(fType, fPass, fCutoff1, coeffs1 + filterLen/2, filterLen);
-       fPass[0] = 'h'; // HIGH_PASS, not LOW_PASS
-       loadfilter(fType, fPass, fCutoff2, coeffs2, filterLen);
-  
-       //for band, we cascade the filters via convolution.
-       convol((DATA*)coeffs1, (DATA*)coeffs2, (DATA*)coeffs1, filterLen, filterLen);
-       if(command == 5) //if notch, flip the band filter.
-       {
-         for(int i = 0; i < filterLen; i++)
-         {
-           coeffs1[i] *= -1;// * (coeffs2[i] + coeffs1[i]);
-         }
-         coeffs1[filterLen/2]+=32767;
-       }
-       if (channel == CHAN_LEFT) //channel 0 == left
-       {
-         memcpy(FIRcoeffsL, coeffs1, filterLen);
-         FIRTagL = 1;
-       }
-       else if (channel == CHAN_RIGHT) //channel 1 == right
-       {
-         memcpy(FIRcoeffsR, coeffs1, filterLen);
-         FIRTagR = 1;
-       }
-       else if (channel == CHAN_BOTH) //channel 2 == both
-       {
-         memcpy(FIRcoeffsL, coeffs1, filterLen);
-         memcpy(FIRcoeffsR, coeffs1, filterLen);       
-         FIRTagL = 1;
-         FIRTagR = 1;
-       }
+       taps = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
+     }
+     firDesignStore(channel, command - 1, taps, f1, f2, FIR_WINDOW_BLACKMAN); //commands 2..5 are LOW_PASS..BAND_STOP
+}
+
+//<int command><int channel><int type><int taps><int f1><int f2><int window>
+void FIRDesign(int channel)
+{
+     int type = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+     unsigned int taps = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
+     unsigned int f1 = (shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8];
+     unsigned int f2 = (shieldMailbox.inbox[11]<<8) + shieldMailbox.inbox[10];
+     int window = (shieldMailbox.inbox[13]<<8) + shieldMailbox.inbox[12];
+     firDesignStore(channel, type, taps, f1, f2, window);
+}
+
+//a narrow low pass or band pass run at the sample rate divided by factor (2, 4 or 8).
+//taps and the band edges are at the low rate, so the filter spans factor times as many
+//input samples; the edges should stay below a quarter of the low rate.
+//<int command><int channel><int type><int taps><int f1><int f2><int window><int factor>
+void FIRMultirate(int channel)
+{
+     int type = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+     unsigned int taps = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
+     unsigned int f1 = (shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8];
+     unsigned int f2 = (shieldMailbox.inbox[11]<<8) + shieldMailbox.inbox[10];
+     int window = (shieldMailbox.inbox[13]<<8) + shieldMailbox.inbox[12];
+     int factor = (shieldMailbox.inbox[15]<<8) + shieldMailbox.inbox[14];
+     if((taps < 3) || (taps > FILTER_LENGTH_MAX) || !(taps & 1))
+     {
+       taps = FILTER_LENGTH_DEFAULT;
+     }
+     //high pass and band stop pass the band the low rate drops
+     if(!firMultirateValid(factor) || (type == HIGH_PASS) || (type == BAND_STOP)
+        || !firDesign(firDesignTaps, taps, type, f1, f2, audioRing.sampleRate / factor, window))
+     {
+       int args[6] = {type, (int) taps, (int) f1, (int) f2, window, factor};
+       logWarn(LOG_EVENT_FIR_REFUSED, args, 6);
+       return;
      }
-}
+     stageParams &params = paramEdit(audioParams);
+     firStoreMultirate(params, channel, firDesignTaps, taps, factor);
+}
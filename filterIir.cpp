@@ -1,22 +1,13 @@
 #include "filterIir.h"
 #include "mailbox.h"
 #include "SD.h"
-#define FILTER_LENGTH_DEFAULT (201)
-#define FILTER_LENGTH_MAX (511)
-#define FILE_CHUNK (100)
-#define MAX_IIR_FREQUENCY (20000)
-// input samples
-extern int filterIn1[I2S_DMA_BUF_LEN];
-extern int filterIn2[I2S_DMA_BUF_LEN];
-
-// intermeidate processing samples
-extern int filterInt1[I2S_DMA_BUF_LEN];
-extern int filterInt2[I2S_DMA_BUF_LEN];
-
-// output samples
-extern int filterOut1[I2S_DMA_BUF_LEN];
-extern int filterOut2[I2S_DMA_BUF_LEN];
-
+#include "paramBank.h"
+#include "coeffCache.h"
+#include "coeffUpload.h"
+#include "iirDesign.h"
+#include "blockRing.h"
+#include "iirParallel.h"
+#include "logRing.h"
 inline void setXF(bool togg)
 {
   if(togg)
@@ -26,151 +17,39 @@ inline void setXF(bool togg)
 
 }
 
-inline void iirCoeffsPrint(iirChannel &channel)
-{
-  Serial.begin(115200);
-  Serial.println("Loaded Coeffs:");
-  for(int i = 0; i < channel.lpf.order/2*COEFFS_PER_BIQUAD; i++) //fix endian-ness of dataset.
-  {
-    Serial.print(channel.lpf.coeffs[i]);
-    Serial.print(",");
-    if((i+1)%COEFFS_PER_BIQUAD==0)
-      Serial.print("\n");
-  }
-  Serial.end();
-}
-//iirConfig lpfL, lpfR, hpfL, hpfR;
-iirChannel iirL, iirR;
-
-int IIRcoeffsL_L[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2] = {0};
+//the channels and their coefficients are banked in paramBank.h, the delay lines are shared by both banks.
 long IIRdelayBufferL_L[IIR_DELAY_BUF_SIZE] = {0};
-
-int IIRcoeffsR_L[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2] = {0};
 long IIRdelayBufferR_L[IIR_DELAY_BUF_SIZE] = {0};
-
-int IIRcoeffsL_H[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2] = {0};
 long IIRdelayBufferL_H[IIR_DELAY_BUF_SIZE] = {0};
-
-int IIRcoeffsR_H[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2] = {0};
 long IIRdelayBufferR_H[IIR_DELAY_BUF_SIZE] = {0};
 
-int loadfilterIIR(char *fresponse, char *fpass, int Hz, int* target, int order)
+int loadfilterIIR(int type, int pass, int Hz, int* target, int order)
 {
-  if(order % 2) //if order is odd, return error, as order must be even for these IIR biquad filters.
-  {
+  long fs = audioRing.sampleRate;
+  coeffKey key = coeffKeyMake(type, pass, order, Hz, fs);
+#if LOG_LEVEL >= LOG_LEVEL_WARN //the records' arguments, only where a record is kept
+  int args[5] = {type, pass, Hz, order, 1};
+#endif
+  if((type == TYPE_ELLIP) && (order > IIR_ELLIP_ORDER_MAX))
+  {
+    logWarn(LOG_EVENT_IIR_REFUSED, args, 4);
     return 0;
   }
-  
-  File fileHandle;
-  char fileName[32];
-  //int newCoeffs[FILTER_LENGTH_MAX] = {0};
-  if(Hz > MAX_IIR_FREQUENCY) //if cutoff frequency exceeds file max, set cutoff to max
+  if(coeffCacheGet(key, target, order/2*COEFFS_PER_BIQUAD)) //retuned to this cutoff before, skip the design
   {
-    Hz = MAX_IIR_FREQUENCY;
+    logInfo(LOG_EVENT_IIR_DESIGN, args, 5);
+    return 1;
   }
-  
-  
-  long shortHz = Hz; //target frequency
-  shortHz *= order/2; //convert order to # biquads. 
-  shortHz *= COEFFS_PER_BIQUAD; // 2 bytes per coefficient, 7 coefficients per biquad 2nd order per biquad;
-
-  sprintf(fileName, "iir/%s/%s/%d.iir",fresponse,fpass,order); //path to IIR filter file, e.g. iir/che/hpf/10.iir is a 10th order chebyshev high pass filter file.
-  
-  //debugging serial output.
-  Serial.begin(115200);
-  Serial.print("\n");
-  Serial.print("File: ");
-  Serial.println(fileName);
-  Serial.print("Response: ");
-  Serial.println(fresponse);
-  Serial.print("Pass: ");
-  Serial.println(fpass);
-  Serial.print("Cutoff: ");
-  Serial.println(Hz);
-  Serial.print("Order: ");
-  Serial.println(order);
-
-  #ifdef AUDIO_INTERRUPTION //only if we want to interrupt filtering for faster loads.
-    AudioC.detachIntr(); //turning off the audio fixes audio / sd card collision
-  #endif
-
-  //open the file
-  fileHandle = SD.open(fileName, FILE_READ);
-
-  if(fileHandle) //if file open successful
+  if(!iirDesign(target, order, type, pass, Hz, fs))
   {
-    long offset; //holds variable inidicating cutoff frequency of first filter in the array
-    int temp;
-    fileHandle.read(&temp,1); //read the first word to get offset. Different files start at different frequencies
-    offset = temp; //store in a long to allow for byte computation
-    if(fpass[0] == 'l') // low pass filter
-    {
-      if(Hz < offset) //if less than the minimum frequncy, set to minimum frequency
-      {
-        shortHz = offset;
-        shortHz *= order/2; //convert order to # biquads. 
-        shortHz *= COEFFS_PER_BIQUAD; // 2 bytes per coefficient, 7 coefficients per biquad 2nd order per biquad;
-      }
-      
-      //debug, report min frequency
-      Serial.print("Min Filter: ");
-      Serial.println(offset);
-    }
-    else //high pass filter
-    {
-      if(Hz > offset) //if cutoff > max, set to max
-      {
-        shortHz = offset;
-        shortHz *= order/2; //convert order to # biquads. 
-        shortHz *= COEFFS_PER_BIQUAD; // 2 bytes per coefficient, 7 coefficients per biquad 2nd order per biquad;
-        offset = 0;
-      }
-    }
-    
-    
-    //convert offset from Hz to number of words
-    offset *= order/2*COEFFS_PER_BIQUAD; //number of coefficients per Hz
-    offset -= 1; //account for the first word
-
-    //debugging serial output
-    Serial.print("Computed Offset: ");
-    Serial.println(offset);
-    Serial.print("Filter Target: ");
-    Serial.println(shortHz);
-    Serial.print("Seek Target: ");
-    Serial.println(shortHz - offset);
-
-    fileHandle.seek((shortHz - offset)*2);
-    fileHandle.read(target, order/2*COEFFS_PER_BIQUAD); //load the data
-    fileHandle.close();
-    Serial.println("Coeffs:");
-    for(int i = 0; i < order/2*COEFFS_PER_BIQUAD; i++) //fix endian-ness of dataset.
-    {
-      Serial.print(target[i]);
-      Serial.print(",");
-      if((i+1)%COEFFS_PER_BIQUAD==0)
-        Serial.print("\n");
-    }
-    
-    Serial.print("\n");
-    Serial.end();
-    #ifdef AUDIO_INTERRUPTION
-        bool status = AudioC.Audio(TRUE);
-        AudioC.setSamplingRate(SAMPLING_RATE_44_KHZ);
-        if (status == 0)
-        {
-          AudioC.attachIntr(dmaIsr);
-        }
-    #endif
-  }
-  else
-  {
-    Serial.begin(115200);
-    Serial.println("File Open Failed.");
-    Serial.end();
+    logWarn(LOG_EVENT_IIR_FAILED, args, 4);
     return 0;
   }
-  Serial.end();
+  coeffCachePut(key, target, order/2*COEFFS_PER_BIQUAD);
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+  args[4] = 0;
+#endif
+  logInfo(LOG_EVENT_IIR_DESIGN, args, 5);
   return 1;
 }
 
@@ -191,17 +70,17 @@ iirConfig initIIR()
   return(initIIR(0,0)); //don't initialize coeffs and delay buffer.
 }
 
-inline void processIIR(iirConfig &config)
+inline void processIIR(iirConfig &config, int frameSize)
 {
   if(config.enabled)
   {
     if(config.src == config.dst) //process in place if possible to save cycles.
     {
-      filter_iirArbitraryOrder(I2S_DMA_BUF_LEN, config.src, config.coeffs, config.delayBuf, config.order);  //filter in place src = dst
+      filter_iirArbitraryOrder(frameSize, config.src, config.coeffs, config.delayBuf, config.order);  //filter in place src = dst
     }
     else
     {
-      filter_iirArbitraryOrder(I2S_DMA_BUF_LEN, config.src, config.dst, config.coeffs, config.delayBuf, config.order);  //filter in place src = dst
+      filter_iirArbitraryOrder(frameSize, config.src, config.dst, config.coeffs, config.delayBuf, config.order);  //filter in place src = dst
     }
   }
 }
@@ -215,75 +94,56 @@ iirChannel newIIRChannel(long* bufferL, long* bufferH, int* coeffL, int* coeffH)
   return newChannel;
 }
 
-void configureIIRChannel(iirChannel &channel, int mode, int* bufferin, int* bufferout, int* bufferint)
-//the HIGH_PASS destination buffer should always contain the final result of all filter operations.
+void configureIIRChannel(iirChannel &channel, int mode, int* bufferin)
+//every mode works in place on bufferin.
 {
   channel.mode = mode;
   if(mode == LOW_PASS)
   {
     //low pass filter, configured such that the lpf directly goes 
-    //in->[lpf]->out
-    channel.lpf.src = bufferin;
-    channel.lpf.dst = bufferin;
-
-    channel.hpf.src = bufferin;
-    channel.hpf.dst = bufferin;
-
+    //in->[lpf]->in
     channel.lpf.enabled = 1;
     channel.hpf.enabled = 0;
   }
   else if(mode == HIGH_PASS)
   {
     //high pass filter, configured such that the hpf directly goes 
-    //in->[hpf]->out
-    channel.lpf.src = bufferin;
-    channel.lpf.dst = bufferin;
-
-    channel.hpf.src = bufferin;
-    channel.hpf.dst = bufferin;
-
+    //in->[hpf]->in
     channel.lpf.enabled = 0;
     channel.hpf.enabled = 1;    
   }
-  else if(mode == BAND_PASS)
+  else if((mode == BAND_PASS) || (mode == BAND_STOP))
   {
-    //band pass filter, configured such that the filters are cascaded. 
-    //in->[lpf]->intermediate->[hpf]->out
-    channel.lpf.src = bufferin;
-    channel.lpf.dst = bufferin;
-
-    channel.hpf.src = bufferin;
-    channel.hpf.dst = bufferin;
-
+    //band pass cascades the filters in place, in->[lpf]->[hpf]->in.
+    //band stop parallels them, in->[lpf] + in->[hpf] -> in, summed by iirParallelFilter.
     channel.lpf.enabled = 1;
     channel.hpf.enabled = 1;
   }
-  else if(mode == BAND_STOP)
+  else if(mode == PARALLEL_SUM)
   {
-    //band stop filter, configured such that the filters are paralleled. 
-    //in->[lpf]->intermediate, in->[hpf]->out, (out + intermediate) / 2 -> out 
-    //(handled by the IIRProcessChannel function)
-    channel.lpf.src = bufferint;
-    channel.lpf.dst = bufferint;
-
-    channel.hpf.src = bufferin;
-    channel.hpf.dst = bufferout;
-
+    //in->[biquad 1] + in->[biquad 2] + ... -> in, over the low pass set.
     channel.lpf.enabled = 1;
-    channel.hpf.enabled = 1;
+    channel.hpf.enabled = 0;
   }
-  else //no filters enabled, point the output to the input, so that the fir filter routine copies the data out.
+  else //no filters enabled, the data stays where it is.
   {
-    channel.lpf.src = bufferin;
-    channel.lpf.dst = bufferin;
-
-    channel.hpf.src = bufferin;
-    channel.hpf.dst = bufferin;
-
     channel.lpf.enabled = 0;
     channel.hpf.enabled = 0;
-
   }
+  bindIIRChannel(channel, bufferin);
+}
+
+void setIIRChannelMode(iirChannel &channel, int mode)
+{
+  configureIIRChannel(channel, mode, channel.hpf.src);
+}
+
+void bindIIRChannel(iirChannel &channel, int* buffer)
+{
+  channel.hpf.src = buffer;
+  channel.hpf.dst = buffer;
+  channel.lpf.src = buffer;
+  channel.lpf.dst = buffer;
 }
 
 void deconfigureIIRChannel(iirChannel &channel)
@@ -292,198 +152,96 @@ void deconfigureIIRChannel(iirChannel &channel)
   channel.hpf = initIIR(0,0);
 }
 
-void IIRProcessChannel(iirChannel &channel)
+void IIRProcessChannel(iirChannel &channel, int frameSize)
 {
   if (channel.mode == LOW_PASS) //low pass
   {
-    processIIR(channel.lpf);
+    processIIR(channel.lpf, frameSize);
   }
   else if (channel.mode == HIGH_PASS) //high pass
   {
-    processIIR(channel.hpf);
+    processIIR(channel.hpf, frameSize);
   }
   else if (channel.mode == BAND_PASS) //band pass
   {
-    processIIR(channel.lpf);
-    processIIR(channel.hpf);    
+    processIIR(channel.lpf, frameSize);
+    processIIR(channel.hpf, frameSize);    
   }
-  else if(channel.mode == BAND_STOP) //band stop
+  else if(channel.mode == BAND_STOP) //band stop, a disabled side passes its input
   {
-    memcpy(channel.lpf.src, channel.hpf.src, I2S_DMA_BUF_LEN);
-    processIIR(channel.hpf);
-    processIIR(channel.lpf);
-    IIRsumChannels(channel.hpf, channel.lpf, I2S_DMA_BUF_LEN);
+    iirBranch branches[2];
+    branches[0].coeffs = channel.hpf.coeffs;
+    branches[0].delayBuf = channel.hpf.delayBuf;
+    branches[0].sections = channel.hpf.enabled ? channel.hpf.order/2 : 0;
+    branches[1].coeffs = channel.lpf.coeffs;
+    branches[1].delayBuf = channel.lpf.delayBuf;
+    branches[1].sections = channel.lpf.enabled ? channel.lpf.order/2 : 0;
+    iirParallelFilter(channel.hpf.src, branches, 2, frameSize);
   }
-
-}
-
-void IIRsumChannels(iirConfig &one, iirConfig &two, int len) //sums the output buffers of two iirConfigs, divided by two to prevent overflows. Stores the result in one.
-{
-  for(int i = 0; i < len; i++)
+  else if((channel.mode == PARALLEL_SUM) && channel.lpf.enabled) //sum of biquads
   {
-    one.dst[i] += two.dst[i];
+    iirBranch branches[IIR_BRANCH_MAX];
+    int count = channel.lpf.order/2;
+    for(int b = 0; b < count; b++)
+    {
+      branches[b].coeffs = channel.lpf.coeffs + b*COEFFS_PER_BIQUAD;
+      branches[b].delayBuf = channel.lpf.delayBuf + b*DELAY_COUNT;
+      branches[b].sections = 1;
+    }
+    iirParallelFilter(channel.lpf.src, branches, count, frameSize);
   }
 }
-void printFilterData(iirConfig &filter)
+void printFilterData(iirConfig &filter, int pass)
 {
-  Serial.println(filter.order);
-  for(int i = 0; i < filter.order/2 * 7; i++)
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG //nothing to build the records for otherwise
+  for(int b = 0; b < filter.order/2; b++) //a record a biquad, a0 is always 16384
   {
-    Serial.print(filter.coeffs[i]);
-    Serial.print(", ");
-    if(i%7 == 6)
-    {
-      Serial.print('\n');
-    }
+    const int* c = filter.coeffs + b*COEFFS_PER_BIQUAD;
+    int args[LOG_ARGS] = {pass, b, c[0], c[1], c[2], c[4], c[5]};
+    logDebug(LOG_EVENT_IIR_SECTION, args, LOG_ARGS);
   }
+#else
+  (void)filter;
+  (void)pass;
+#endif
 }
 void printIIRData(iirChannel &channel)
 {
-  Serial.begin(115200);
-  printFilterData(channel.lpf);
-  printFilterData(channel.hpf);     
-  Serial.end(); 
+  printFilterData(channel.lpf, LOW_PASS);
+  printFilterData(channel.hpf, HIGH_PASS);
 }
 
+//the coefficients are decoded straight into the shadow bank, as a one chunk upload.
 void IIRRecieve(int channel)
 {
   int order = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
   int dest = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
-  int* newData = (int*) malloc(shieldMailbox.inboxSize/2);  
-  //Working read via serial code
-  for(int i = 8; i < shieldMailbox.inboxSize; i = i + 2) //copy recieved coefficients to buffer.
+  unsigned int words = shieldMailbox.inboxSize/2 - 4; //command, channel, order and dest take up 4 words
+  int target = (dest == LOW_PASS) ? UPLOAD_IIR_LOW : ((dest == HIGH_PASS) ? UPLOAD_IIR_HIGH : -1);
+  if(uploadBegin(target, channel, 0, order, order, dest))
   {
-    newData[i/2 - 4] = ((shieldMailbox.inbox[i+1]<<8) + shieldMailbox.inbox[i]);
+    uploadWords(0, shieldMailbox.inbox + 8, (words > audioUpload.words) ? audioUpload.words : words);
+    uploadEnd(1);
   }
-
-  if(dest == LOW_PASS)
-  {
-    int newDataLen = shieldMailbox.inboxSize/2 - 4;
-    //int newDataLen = order/2*COEFFS_PER_BIQUAD;
-    if(channel == CHAN_LEFT) //channel 0 == left
-    {
-      iirL.lpf.order = order;
-      memcpy(iirL.lpf.coeffs, newData, newDataLen); //copy into low pass coefficients
-      configureIIRChannel(iirL,LOW_PASS,filterIn1, filterOut1, filterInt1);  //configure blocks
-    }
-    else if (channel == CHAN_RIGHT) //channel 1 == right
-    {
-      iirR.lpf.order = order;
-      memcpy(iirR.lpf.coeffs, newData, newDataLen); //copy into low pass coefficients
-      configureIIRChannel(iirR,LOW_PASS,filterIn2, filterOut2, filterInt2); //configure blocks
-    }
-    else if (channel == CHAN_BOTH) //channel 2 == both
-    {
-      iirL.lpf.order = order;
-      memcpy(iirL.lpf.coeffs, newData, newDataLen); //copy into low pass coefficients
-
-      iirR.lpf.order = order;
-      memcpy(iirR.lpf.coeffs, newData, newDataLen); //copy into low pass coefficients
-
-      configureIIRChannel(iirL,LOW_PASS,filterIn1, filterOut1, filterInt1); //configure blocks
-      configureIIRChannel(iirR,LOW_PASS,filterIn2, filterOut2, filterInt2);
-    }
-
-  }
-  else if(dest == HIGH_PASS)
-  {
-    int newDataLen = shieldMailbox.inboxSize/2 - 4;
-    //int newDataLen = order/2*COEFFS_PER_BIQUAD;
-    if(channel == CHAN_LEFT) //channel 0 == left
-    {
-      iirL.hpf.order = order;
-      memcpy(iirL.hpf.coeffs, newData, newDataLen); //copy into low pass coefficients
-      configureIIRChannel(iirL,HIGH_PASS,filterIn1, filterOut1, filterInt1);  //configure blocks
-    }
-    else if (channel == CHAN_RIGHT) //channel 1 == right
-    {
-      iirR.hpf.order = order;
-      memcpy(iirR.hpf.coeffs, newData, newDataLen); //copy into low pass coefficients
-      configureIIRChannel(iirR,HIGH_PASS,filterIn2, filterOut2, filterInt2); //configure blocks
-    }
-    else if (channel == CHAN_BOTH) //channel 2 == both
-    {
-      iirL.hpf.order = order;
-      memcpy(iirL.hpf.coeffs, newData, newDataLen); //copy into low pass coefficients
-
-      iirR.hpf.order = order;
-      memcpy(iirR.hpf.coeffs, newData, newDataLen); //copy into low pass coefficients
-
-      configureIIRChannel(iirL,HIGH_PASS,filterIn1, filterOut1, filterInt1); //configure blocks
-      configureIIRChannel(iirR,HIGH_PASS,filterIn2, filterOut2, filterInt2);
-    }
-
-  }
-  free(newData);
 }
 void IIRRecieveDual(int channel)
 {
   int order1 = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
   int order2 = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
   int filterType = (shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8];
-  int* newData = (int*) malloc(shieldMailbox.inboxSize/2);  
-  //Working read via serial code
-  for(int i = 10; i < order1*COEFFS_PER_BIQUAD+10; i = i + 2) //copy recieved coefficients to buffer.
-  {
-    newData[i/2 - 5] = ((shieldMailbox.inbox[i+1]<<8) + shieldMailbox.inbox[i]);
-  }
-
-
-  if (channel == CHAN_LEFT) //channel 0 == left
-  {
-    iirL.lpf.order = order1;
-    memcpy(iirL.lpf.coeffs, newData, order1/2*COEFFS_PER_BIQUAD);
-  }
-  else if (channel == CHAN_RIGHT) //channel 1 == right
-  {
-    iirR.lpf.order = order1;
-    memcpy(iirR.lpf.coeffs, newData, order1/2*COEFFS_PER_BIQUAD);
-  }
-  else if (channel == CHAN_BOTH) //channel 2 == both
-  {
-    iirL.lpf.order = order1;
-    memcpy(iirL.lpf.coeffs, newData, order1/2*COEFFS_PER_BIQUAD);
-
-    iirR.lpf.order = order1;
-    memcpy(iirR.lpf.coeffs, newData, order1/2*COEFFS_PER_BIQUAD);
-  }
-
-  for(int i = 10+order1*COEFFS_PER_BIQUAD; i < shieldMailbox.inboxSize; i = i + 2) //copy recieved coefficients to buffer.
-  {
-    newData[i/2 - 5 - order1/2*COEFFS_PER_BIQUAD] = ((shieldMailbox.inbox[i+1]<<8) + shieldMailbox.inbox[i]);
-  }
-
-  if (channel == CHAN_LEFT) //channel 0 == left
-  {
-    iirL.hpf.order = order2;
-    memcpy(iirL.hpf.coeffs, newData, order2/2*COEFFS_PER_BIQUAD);
-    configureIIRChannel(iirL,filterType,filterIn1, filterOut1, filterInt1); //configure blocks
-  }
-  else if (channel == CHAN_RIGHT) //channel 1 == right
-  {
-    iirR.hpf.order = order2;
-    memcpy(iirR.hpf.coeffs, newData, order2/2*COEFFS_PER_BIQUAD);
-    configureIIRChannel(iirR,filterType,filterIn2, filterOut2, filterInt2); //configure blocks
-  }
-  else if (channel == CHAN_BOTH) //channel 2 == both
+  unsigned int words = shieldMailbox.inboxSize/2 - 5; //low pass then high pass coefficients
+  if(uploadBegin(UPLOAD_IIR_DUAL, channel, 0, order1, order2, filterType))
   {
-    iirL.hpf.order = order2;
-    memcpy(iirL.hpf.coeffs, newData, order2/2*COEFFS_PER_BIQUAD);
-
-    iirR.hpf.order = order2;
-    memcpy(iirR.hpf.coeffs, newData, order2/2*COEFFS_PER_BIQUAD);
-
-    configureIIRChannel(iirL,filterType,filterIn1, filterOut1, filterInt1); //configure blocks
-    configureIIRChannel(iirR,filterType,filterIn2, filterOut2, filterInt2);
-
+    uploadWords(0, shieldMailbox.inbox + 10, (words > audioUpload.words) ? audioUpload.words : words);
+    uploadEnd(1);
   }
-  //printIIRData(iirL);
-  //printIIRData(iirR);
-  free(newData);
 }
 
 void IIRLoad(int command, int channel)
 {
+  stageParams &params = paramEdit(audioParams); //coefficients go to the shadow bank
+  iirChannel &iirL = params.iir[CHAN_LEFT];
+  iirChannel &iirR = params.iir[CHAN_RIGHT];
   //grab pass, response, cutoff1   
   int pass = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
   int response = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
@@ -492,35 +250,9 @@ void IIRLoad(int command, int channel)
   int target[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2] = {
     0  };
 
-  char *fresponse;
-  if(response == TYPE_BUTTER)
-  {
-    fresponse = "btr";
-  }
-  else if(response == TYPE_BESSEL)
-  {
-    fresponse = "bsl";
-  }
-  else if(response == TYPE_ELLIP)
-  {
-    fresponse = "elp";
-  }
-  else if(response == TYPE_CHEBY)
-  {
-    fresponse = "che";
-  }
-
-  char *fpass;
-  if(pass == HIGH_PASS)
-  {
-    fpass = "hpf";
-  }
-  else
-  {
-    fpass = "lpf";
-  }   
-  if(loadfilterIIR(fresponse, fpass, cutoff, target, order)) //low / high pass
+  if(loadfilterIIR(response, (pass == HIGH_PASS) ? HIGH_PASS : LOW_PASS, cutoff, target, order)) //low / high pass
   {
+    iirLink(params, channel, (pass == HIGH_PASS) ? 1 : 0);
     if(pass == HIGH_PASS)
     {
       if (channel == CHAN_LEFT) //channel 0 == left
@@ -536,10 +268,8 @@ void IIRLoad(int command, int channel)
       else if (channel == CHAN_BOTH) //channel 2 == both
       {
         iirL.hpf.order = order;
-        memcpy(iirL.hpf.coeffs, target, order/2*COEFFS_PER_BIQUAD);
-
+        memcpy(iirL.hpf.coeffs, target, order/2*COEFFS_PER_BIQUAD); //the right channel is linked to it
         iirR.hpf.order = order;
-        memcpy(iirR.hpf.coeffs, target, order/2*COEFFS_PER_BIQUAD);
       }
     }
     else
@@ -557,10 +287,8 @@ void IIRLoad(int command, int channel)
       else if (channel == CHAN_BOTH) //channel 2 == both
       {
         iirL.lpf.order = order;
-        memcpy(iirL.lpf.coeffs, target, order/2*COEFFS_PER_BIQUAD);
-
+        memcpy(iirL.lpf.coeffs, target, order/2*COEFFS_PER_BIQUAD); //the right channel is linked to it
         iirR.lpf.order = order;
-        memcpy(iirR.lpf.coeffs, target, order/2*COEFFS_PER_BIQUAD);
       }
     }
   }
@@ -569,9 +297,9 @@ void IIRLoad(int command, int channel)
   if(command == 9) //band pass / stop
   {
     int cutoff = (shieldMailbox.inbox[11]<<8) + shieldMailbox.inbox[10];  //cutoff 2 for band pass / stop   
-    fpass = "hpf";
-    if(loadfilterIIR(fresponse, fpass, cutoff, target, order)) //low / high pass
+    if(loadfilterIIR(response, HIGH_PASS, cutoff, target, order)) //low / high pass
     {
+      iirLink(params, channel, 1);
       if (channel == CHAN_LEFT) //channel 0 == left
       {
         iirL.hpf.order = order;
@@ -585,28 +313,32 @@ void IIRLoad(int command, int channel)
       else if (channel == CHAN_BOTH) //channel 2 == both
       {
         iirL.hpf.order = order;
-        memcpy(iirL.hpf.coeffs, target, order/2*COEFFS_PER_BIQUAD);
-
+        memcpy(iirL.hpf.coeffs, target, order/2*COEFFS_PER_BIQUAD); //the right channel is linked to it
         iirR.hpf.order = order;
-        memcpy(iirR.hpf.coeffs, target, order/2*COEFFS_PER_BIQUAD);
       }
     }
   }
 
   if(channel == CHAN_LEFT)
   {
-    configureIIRChannel(iirL,pass,filterIn1, filterOut1, filterInt1); //configure blocks
+    setIIRChannelMode(iirL,pass); //configure blocks
   }
   else if(channel == CHAN_RIGHT)
   {
-    configureIIRChannel(iirR,pass,filterIn2, filterOut2, filterInt2);
+    setIIRChannelMode(iirR,pass);
   }
   else if(channel == CHAN_BOTH)
   {
-    configureIIRChannel(iirL,pass,filterIn1, filterOut1, filterInt1); //configure blocks
-    configureIIRChannel(iirR,pass,filterIn2, filterOut2, filterInt2);
+    setIIRChannelMode(iirL,pass); //configure blocks
+    setIIRChannelMode(iirR,pass);
+  }
+  if(channel != CHAN_RIGHT) //a few records into the log, or nothing below LOG_LEVEL_DEBUG
+  {
+    printIIRData(iirL);
+  }
+  if(channel != CHAN_LEFT)
+  {
+    printIIRData(iirR);
   }
-  //iirCoeffsPrint(iirR);
-  //iirCoeffsPrint(iirL);
 }
 
@@ -22,6 +22,7 @@
 #define HIGH_PASS 2
 #define BAND_PASS 3
 #define BAND_STOP 4
+#define PARALLEL_SUM 5 //every low pass biquad runs from the input and their outputs are summed
 
 #define TYPE_BUTTER 0
 #define TYPE_BESSEL 1
@@ -44,43 +45,34 @@ struct iirConfig {
 struct iirChannel {
   iirConfig hpf;
   iirConfig lpf;
-  int mode; //lpf, hpf, bpf, bsf 
+  int mode; //lpf, hpf, bpf, bsf, parallel sum
 };
 
 iirConfig initIIR(); //initialize channel without configuring filter buffers
 iirConfig initIIR(long* buffer, int *coeff); //initialize channel
 
-int loadfilterIIR(char *fresponse, char *fpass, int Hz, int *target, int order); //loads an IIR filter into a buffer (target) from disk.
+int loadfilterIIR(int type, int pass, int Hz, int *target, int order); //designs an IIR filter into a buffer (target), or copies it from the cache.
 void recvfilterIIR(iirConfig &config, int order, int *coeffs); //loads an IIR filter into a buffer (config) from disk.
 
-void IIRsumChannels(iirConfig &one, iirConfig &two, int len); //sums the output buffers of two iirConfigs, divided by two to prevent overflos
-void IIRProcessChannel(iirChannel &channel); //process both iir filters in the channel.
+void IIRProcessChannel(iirChannel &channel, int frameSize); //process both iir filters in the channel.
 iirChannel newIIRChannel(long* bufferL, long* bufferH, int* coeffL, int* coeffH); //initailize the channel.
-void configureIIRChannel(iirChannel &channel, int mode, int* bufferin, int* bufferout, int* bufferint); //configure the channel's input and output buffers.
+void configureIIRChannel(iirChannel &channel, int mode, int* bufferin); //configure the channel's mode and buffer, the result is left in bufferin.
+void setIIRChannelMode(iirChannel &channel, int mode); //configure the mode, keeping the buffers the channel is bound to.
+void bindIIRChannel(iirChannel &channel, int* buffer); //point the channel at a new block without touching its mode.
 void deconfigureIIRChannel(iirChannel &channel); //disable channel, point everything to zero (watch out).
 
-void processIIR(iirConfig &config); //process an IIR channel
+void processIIR(iirConfig &config, int frameSize); //process an IIR channel
 
 void IIRRecieve(int channel); //recieve new coefficients for LPF or HPF. channel == left or right (0, 1);
 void IIRRecieveDual(int channel); //recieve new coefficients for BPF or BSF. channel == left or right (0, 1);
 
-void printIIRData(iirChannel &channel); //debug print. Prints coefficients.
-void printFilterData(iirConfig &filter); //
+void printIIRData(iirChannel &channel); //logs both coefficient sets at LOG_LEVEL_DEBUG, a record a biquad
+void printFilterData(iirConfig &filter, int pass); //logs one set, pass tells the records apart
 void IIRLoad(int command, int channel);
-extern iirChannel iirL, iirR; //two IIR Channels for stereo.
-
-
-//external buffers.
-extern int IIRcoeffsL_L[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2];
+//external buffers, shared by both parameter banks.
 extern long IIRdelayBufferL_L[IIR_DELAY_BUF_SIZE];
-
-extern int IIRcoeffsR_L[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2];
 extern long IIRdelayBufferR_L[IIR_DELAY_BUF_SIZE];
-
-extern int IIRcoeffsL_H[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2];
 extern long IIRdelayBufferL_H[IIR_DELAY_BUF_SIZE];
-
-extern int IIRcoeffsR_H[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2];
 extern long IIRdelayBufferR_H[IIR_DELAY_BUF_SIZE];
 
 #endif
@@ -0,0 +1,194 @@
+#include "firDesign.h"
+
+//sin(pi/2*z) = z*(1 + A1 + A3*z^2 + A5*z^4 + A7*z^6) on a quarter turn, a least
+//squares fit at Chebyshev nodes, within 2 LSB of Q15.
+#define SINE_A1 18704 //(1.5707919 - 1) in Q15, the 1 is added as z
+#define SINE_A3 (-21165)
+#define SINE_A5 2603
+#define SINE_A7 (-142)
+
+int firSine(unsigned int phase)
+{
+  phase &= 0xFFFF;
+  unsigned int quarter = phase & 0x3FFF;
+  if(phase & 0x4000) //second and fourth quarters run backwards
+  {
+    quarter = 0x4000 - quarter;
+  }
+  long z = (long) quarter << 1; //Q15, 0 to 1
+  long z2 = (z*z + 0x4000) >> 15;
+  long t = SINE_A7;
+  t = SINE_A5 + ((t*z2 + 0x4000) >> 15);
+  t = SINE_A3 + ((t*z2 + 0x4000) >> 15);
+  t = SINE_A1 + ((t*z2 + 0x4000) >> 15);
+  long s = z + ((t*z + 0x4000) >> 15);
+  if(s > 32767)
+  {
+    s = 32767;
+  }
+  return (phase & 0x8000) ? -(int) s : (int) s;
+}
+
+//num/den in Q15 by restoring division to 16 bits, rounded, den > 0. The quotient saturates.
+int ratioQ15(long num, long den)
+{
+  int negative = num < 0;
+  if(negative)
+  {
+    num = -num;
+  }
+  if(num >= den)
+  {
+    return negative ? -32767 : 32767;
+  }
+  unsigned int q = 0;
+  for(int b = 0; b < 16; b++)
+  {
+    num <<= 1;
+    q <<= 1;
+    if(num >= den)
+    {
+      num -= den;
+      q |= 1;
+    }
+  }
+  q = (q + 1) >> 1;
+  if(q > 32767)
+  {
+    q = 32767;
+  }
+  return negative ? -(int) q : (int) q;
+}
+
+//a*b >> 15 for a 32 bit a and a Q15 b, without a 64 bit product.
+long mulQ15(long a, int b)
+{
+  return (a >> 15) * b + (((a & 0x7FFF) * b + 0x4000) >> 15);
+}
+
+//I0 of sqrt(4y), the Kaiser window's Bessel function, with y in Q10 and the result in Q12.
+//The series terms are ((sqrt(4y)/2)^k/k!)^2 = y^k/(k!)^2.
+long besselI0(long y)
+{
+  long term = 4096;
+  long sum = term;
+  for(int k = 1; (k < 40) && term; k++)
+  {
+    term = ((term >> 10) * y + (((term & 1023) * y) >> 10)) / ((long) k*k);
+    sum += term;
+  }
+  return sum;
+}
+
+//window value at distance n from the centre tap of a 2*half+1 tap filter, in Q15.
+int firWindow(unsigned int n, unsigned int half, int window, long i0Beta)
+{
+  if(window == FIR_WINDOW_BLACKMAN) //0.42 + 0.5*cos(pi*n/half) + 0.08*cos(2*pi*n/half)
+  {
+    unsigned int phase = ((long) n << 15) / half; //half a turn at the ends
+    long w = 13763 + ((firSine(phase + 0x4000) + 1L) >> 1) + ((2621L*firSine(2*phase + 0x4000) + 0x4000) >> 15);
+    return (w > 32767) ? 32767 : ((w < 0) ? 0 : (int) w);
+  }
+  //Kaiser: I0(beta*sqrt(1 - (n/half)^2))/I0(beta)
+  long t = ((long) n << 15) / half;
+  long y = (long) window*window * (32768L - ((t*t) >> 15)) / 12800; //(beta/2)^2*(1 - t^2) in Q10, beta in tenths
+  return ratioQ15(besselI0(y), i0Beta);
+}
+
+//windowed sinc of cutoff fc at distance n from the centre, in Q22. fc is in 1/65536 of a
+//turn per sample, so the phase of the sine wraps exactly.
+long firWindowedSinc(unsigned int fc, unsigned int n, int w)
+{
+  long sinc;
+  if(n == 0)
+  {
+    sinc = (long) fc << 7; //2*fc
+  }
+  else
+  {
+    //sin(2*pi*fc*n)/(pi*n): 20861 is 2^16/pi, the sine is Q15, so the product is Q31
+    sinc = ((firSine((unsigned int)((unsigned long) fc * n)) * 20861L) >> 9) / (long) n;
+  }
+  return mulQ15(sinc, w);
+}
+
+//cutoff in 1/65536 of a turn per sample, f*65536/fs without overflowing 32 bits.
+unsigned int firTurns(long f, long fs)
+{
+  if(f <= 0)
+  {
+    return 0;
+  }
+  if(2*f >= fs)
+  {
+    return 0x8000;
+  }
+  unsigned long scaled = (unsigned long) f << 15;
+  unsigned long q = scaled / fs;
+  unsigned long r = scaled % fs;
+  return (unsigned int)((q << 1) + ((2*r >= (unsigned long) fs) ? 1 : 0));
+}
+
+int firDesign(int* coeffs, unsigned int taps, int type, long f1, long f2, long fs, int window)
+{
+  if((taps < 3) || !(taps & 1) || (type < LOW_PASS) || (type > BAND_STOP))
+  {
+    return 0;
+  }
+  if(window > FIR_KAISER_BETA_MAX)
+  {
+    window = FIR_KAISER_BETA_MAX;
+  }
+  if((type >= BAND_PASS) && (f1 > f2))
+  {
+    long swap = f1;
+    f1 = f2;
+    f2 = swap;
+  }
+  //low pass prototypes: lower at fcLow for every type, upper at fcHigh for the band types.
+  unsigned int fcLow = firTurns(f1, fs);
+  unsigned int fcHigh = (type >= BAND_PASS) ? firTurns(f2, fs) : 0;
+  unsigned int half = taps / 2;
+  long i0Beta = (window == FIR_WINDOW_BLACKMAN) ? 0 : besselI0((long) window*window * 32768L / 12800);
+
+  //first half: the window goes in the taps it will be replaced in, the DC gains are summed.
+  long sumLow = 0, sumHigh = 0;
+  for(unsigned int n = 0; n <= half; n++)
+  {
+    int w = firWindow(n, half, window, i0Beta);
+    coeffs[half - n] = w;
+    int weight = n ? 2 : 1; //taps on both sides of the centre
+    sumLow += weight * firWindowedSinc(fcLow, n, w);
+    sumHigh += weight * firWindowedSinc(fcHigh, n, w);
+  }
+
+  //second half: unity gain prototypes, combined and mirrored.
+  for(unsigned int n = 0; n <= half; n++)
+  {
+    int w = coeffs[half - n];
+    long low = (sumLow > 0) ? ratioQ15(firWindowedSinc(fcLow, n, w), sumLow) : 0;
+    long high = (sumHigh > 0) ? ratioQ15(firWindowedSinc(fcHigh, n, w), sumHigh) : 0;
+    long impulse = n ? 0 : 32767;
+    long tap;
+    if(type == LOW_PASS)
+    {
+      tap = low;
+    }
+    else if(type == HIGH_PASS)
+    {
+      tap = impulse - low;
+    }
+    else if(type == BAND_PASS)
+    {
+      tap = high - low;
+    }
+    else
+    {
+      tap = impulse - high + low;
+    }
+    tap = (tap > 32767) ? 32767 : ((tap < -32768) ? -32768 : tap);
+    coeffs[half - n] = (int) tap;
+    coeffs[half + n] = (int) tap;
+  }
+  return 1;
+}
@@ -0,0 +1,29 @@
+//Windowed sinc FIR design in fixed point, for any cutoff and odd length.
+//Band filters are designed directly, as the difference of two low pass
+//prototypes, rather than by convolving a low pass with a high pass, so they
+//keep the requested length. Each low pass prototype is scaled to unity gain
+//at DC before it is combined. Only half the taps are computed, the filters
+//are linear phase and the other half is a mirror.
+//A design is a few sine evaluations and a 15 step division per tap, cheap
+//enough for a mailbox handler; shieldSim -D times it against the lengths.
+#ifndef _FIRDESIGN_H_INCLUDED	//prevent fir design library from being invoked twice and breaking the namespace
+#define _FIRDESIGN_H_INCLUDED
+
+#include "core.h"
+
+#define LOW_PASS 1
+#define HIGH_PASS 2
+#define BAND_PASS 3
+#define BAND_STOP 4
+
+#define FIR_WINDOW_BLACKMAN 0 //window argument: Blackman, otherwise Kaiser with beta in tenths
+#define FIR_KAISER_BETA_MAX 100 //beta of 10, about 100 dB, past what Q15 taps can hold
+
+//designs a taps long filter into coeffs, in Q15. type is LOW_PASS or HIGH_PASS at f1,
+//or BAND_PASS or BAND_STOP between f1 and f2, all in Hz at sampling rate fs.
+//taps must be odd, from 3 up. Returns 0 and leaves coeffs alone when they are not.
+int firDesign(int* coeffs, unsigned int taps, int type, long f1, long f2, long fs, int window);
+
+int firSine(unsigned int phase); //Q15 sine, phase in 1/65536 of a turn
+
+#endif
@@ -0,0 +1,211 @@
+#include "firFft.h"
+
+firFftState firFftLeft, firFftRight;
+unsigned int firFftCrossover = FIR_FFT_CROSSOVER;
+
+void firFftDesignPart(firSpectra &spectra, int part, const int* coeffs, int count)
+{
+  int* bins = spectra.bins[part];
+  //no bin can exceed the sum of the taps' magnitudes, scale that down to 16 bits.
+  long sum = 0;
+  for(int i = 0; i < count; i++)
+  {
+    sum += (coeffs[i] < 0) ? -coeffs[i] : coeffs[i];
+  }
+  int shift = 0;
+  while(sum > 32767)
+  {
+    sum >>= 1;
+    shift++;
+  }
+  int round = shift ? (1 << (shift - 1)) : 0;
+  for(int i = 0; i < count; i++)
+  {
+    bins[i] = ((long) coeffs[i] + round) >> shift;
+  }
+  memset(bins + count, 0, FIR_FFT_LEN - count); //zero padded to the FFT length
+  rfft((DATA*) bins, FIR_FFT_LEN, NOSCALE);
+  spectra.shift[part] = shift;
+}
+
+void firFftDesign(firSpectra &spectra, const int* coeffs, unsigned int length)
+{
+  if(length > FIR_FFT_TAPS_MAX)
+  {
+    length = FIR_FFT_TAPS_MAX;
+  }
+  spectra.parts = (length + FIR_FFT_PART - 1) / FIR_FFT_PART;
+  for(int p = 0; p < spectra.parts; p++)
+  {
+    int count = length - p*FIR_FFT_PART;
+    firFftDesignPart(spectra, p, coeffs + p*FIR_FFT_PART, (count > FIR_FFT_PART) ? FIR_FFT_PART : count);
+  }
+}
+
+void firFftReset(firFftState &state)
+{
+  memset(state.input, 0, FIR_FFT_LEN);
+  memset(state.history[0], 0, FIR_FFT_PARTS_MAX*FIR_FFT_LEN);
+  memset(state.output, 0, FIR_FFT_PART);
+  memset(state.exponent, 0, FIR_FFT_PARTS_MAX);
+  state.newest = 0;
+  state.fill = 0;
+  state.fadeFrom = 0;
+}
+
+void firCrossfade(int* samples, const int* old, int length)
+{
+  for(int i = 0; i < length; i++)
+  {
+    long gain = ((long)(i + 1) << 15) / length; //the last sample is all new
+    samples[i] = (int)(((long) samples[i] * gain + (long) old[i] * (32768L - gain)) >> 15);
+  }
+}
+
+//bits a block can be shifted up and still fit 16 bits.
+int headroom(const int* samples, int length)
+{
+  int peak = 0;
+  for(int i = 0; i < length; i++)
+  {
+    peak |= (samples[i] < 0) ? ~samples[i] : samples[i];
+  }
+  int bits = 0;
+  while((bits < 15) && !(peak & 0x4000))
+  {
+    peak <<= 1;
+    bits++;
+  }
+  return bits;
+}
+
+//one partition of output from the input spectra in the history.
+//Both transforms run in block floating point: the input window is shifted up to
+//full scale before rfft, and the output spectrum is brought to full scale before
+//a scaled rifft, so quiet signals keep their resolution.
+void firFftOutput(firFftState &state, const firSpectra &spectra, int* output)
+{
+  //partition p of the filter meets the input spectrum p partitions old. Undo the
+  //Q15 taps, the partition and input shifts, and keep FIR_FFT_GUARD extra bits.
+  const int* x[FIR_FFT_PARTS_MAX];
+  int shift[FIR_FFT_PARTS_MAX];
+  long round[FIR_FFT_PARTS_MAX]; //truncating every product would add a bias to every bin
+  for(int p = 0; p < spectra.parts; p++)
+  {
+    int row = (state.newest - p + FIR_FFT_PARTS_MAX) % FIR_FFT_PARTS_MAX;
+    x[p] = state.history[row];
+    shift[p] = 15 - FIR_FFT_GUARD - spectra.shift[p] + state.exponent[row];
+    round[p] = 1L << (shift[p] - 1);
+  }
+  long peak = 0;
+  for(int k = 0; k < FIR_FFT_LEN; k += 2)
+  {
+    long re = 0;
+    long im = 0;
+    for(int p = 0; p < spectra.parts; p++)
+    {
+      const int* h = spectra.bins[p];
+      if(k == 0) //DC and Nyquist are both real
+      {
+        re += ((long) x[p][0] * h[0] + round[p]) >> shift[p];
+        im += ((long) x[p][1] * h[1] + round[p]) >> shift[p];
+      }
+      else
+      {
+        re += ((long) x[p][k] * h[k] - (long) x[p][k+1] * h[k+1] + round[p]) >> shift[p];
+        im += ((long) x[p][k] * h[k+1] + (long) x[p][k+1] * h[k] + round[p]) >> shift[p];
+      }
+    }
+    state.sum[k] = re;
+    state.sum[k+1] = im;
+    peak |= (re < 0) ? ~re : re;
+    peak |= (im < 0) ? ~im : im;
+  }
+
+  //the sum is FIR_FFT_GUARD bits up on what an unscaled rifft needs, a scaled
+  //rifft takes FIR_FFT_LOG2 more. Shift right only as far as 16 bits require.
+  int down = FIR_FFT_GUARD - FIR_FFT_LOG2;
+  while((down < FIR_FFT_GUARD) && ((down < 0) ? (peak > (32767L >> -down)) : ((peak >> down) > 32767)))
+  {
+    down++;
+  }
+  for(int k = 0; k < FIR_FFT_LEN; k++)
+  {
+    long v = state.sum[k];
+    if(down < 0)
+    {
+      v <<= -down;
+    }
+    else if(down > 0)
+    {
+      v = (v + (1L << (down - 1))) >> down;
+    }
+    state.work[k] = (v > 32767) ? 32767 : ((v < -32768) ? -32768 : v);
+  }
+  rifft((DATA*) state.work, FIR_FFT_LEN, SCALE);
+
+  //the first half is circular wrap-around. The second comes back to scale.
+  int up2 = down - FIR_FFT_GUARD + FIR_FFT_LOG2;
+  for(int i = 0; i < FIR_FFT_PART; i++)
+  {
+    long y = (long) state.work[FIR_FFT_PART + i] << up2;
+    output[i] = (y > 32767) ? 32767 : ((y < -32768) ? -32768 : y);
+  }
+}
+
+//one partition of output from a full input partition. The input spectrum does
+//not depend on the filter, so a retune keeps the whole history and only the
+//output is crossfaded, from the old spectra to the new over the partition.
+void firFftPartition(firFftState &state, const firSpectra &spectra)
+{
+  state.newest = (state.newest + 1) % FIR_FFT_PARTS_MAX;
+  int* spectrum = state.history[state.newest];
+  int up = headroom(state.input, FIR_FFT_LEN);
+  for(int i = 0; i < FIR_FFT_LEN; i++)
+  {
+    spectrum[i] = state.input[i] << up;
+  }
+  rfft((DATA*) spectrum, FIR_FFT_LEN, SCALE);
+  state.exponent[state.newest] = up;
+  memcpy(state.input, state.input + FIR_FFT_PART, FIR_FFT_PART); //the current partition becomes the previous one
+
+  firFftOutput(state, spectra, state.output);
+  if(state.fadeFrom)
+  {
+    int old[FIR_FFT_PART];
+    firFftOutput(state, *state.fadeFrom, old);
+    firCrossfade(state.output, old, FIR_FFT_PART);
+    state.fadeFrom = 0;
+  }
+}
+
+void firFftProcess(firFftState &state, const firSpectra &spectra, int* samples, int frameSize)
+{
+  //block lengths are powers of two, so a chunk always ends on a partition boundary.
+  int chunk = (frameSize < FIR_FFT_PART) ? frameSize : FIR_FFT_PART;
+  for(int n = 0; n < frameSize; n += chunk)
+  {
+    int* x = samples + n;
+    memcpy(state.input + FIR_FFT_PART + state.fill, x, chunk);
+    if(chunk < FIR_FFT_PART) //a short block takes the previous partition's output
+    {
+      memcpy(x, state.output + state.fill, chunk);
+    }
+    state.fill += chunk;
+    if(state.fill == FIR_FFT_PART)
+    {
+      firFftPartition(state, spectra);
+      state.fill = 0;
+    }
+    if(chunk == FIR_FFT_PART)
+    {
+      memcpy(x, state.output, FIR_FFT_PART);
+    }
+  }
+}
+
+void firFftCrossoverCommand()
+{
+  //syntax is: <int command><int channel><int taps>, filters longer than taps run in the FFT engine
+  firFftCrossover = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+}
@@ -0,0 +1,52 @@
+//Long FIR filters by uniformly partitioned overlap-save convolution.
+//The filter is cut into FIR_FFT_PART tap partitions whose spectra are computed
+//once, by the mailbox handler that stores the filter. The worker transforms
+//each partition of input once with rfft and keeps the spectra in a frequency
+//domain delay line; the output spectrum is the sum of every filter partition
+//times the input spectrum of its age, and a single rifft brings the last
+//FIR_FFT_PART samples back. Blocks of FIR_FFT_PART samples or more come out
+//without added delay, shorter blocks are buffered and come out a partition late.
+#ifndef _FIRFFT_H_INCLUDED	//prevent fir fft library from being invoked twice and breaking the namespace
+#define _FIRFFT_H_INCLUDED
+
+#include "core.h"
+#include "filter.h"
+#include "mailbox.h"
+
+#define FIR_FFT_PART 256 //partition length, the FFT is twice as long
+#define FIR_FFT_LEN (2*FIR_FFT_PART)
+#define FIR_FFT_LOG2 9 //log2(FIR_FFT_LEN), what a scaled transform divides by
+#define FIR_FFT_PARTS_MAX 16
+#define FIR_FFT_TAPS_MAX (FIR_FFT_PART*FIR_FFT_PARTS_MAX)
+#define FIR_FFT_GUARD 4 //extra bits of the output spectrum sum
+#define FIR_FFT_CROSSOVER 128 //longer filters run in the FFT engine. A starting point, retune it from the device's stage profile with command 34
+
+struct firSpectra {
+  int bins[FIR_FFT_PARTS_MAX][FIR_FFT_LEN]; //rfft packing: DC, Nyquist, then re/im of bins 1..FIR_FFT_PART-1
+  int shift[FIR_FFT_PARTS_MAX]; //each partition was scaled down by this many bits to fit 16 bits
+  int parts; //partitions in use
+};
+
+struct firFftState {
+  int input[FIR_FFT_LEN]; //previous partition of input, then the one being filled
+  int history[FIR_FFT_PARTS_MAX][FIR_FFT_LEN]; //input spectra, a ring
+  int exponent[FIR_FFT_PARTS_MAX]; //bits each input window was shifted up before its rfft
+  int output[FIR_FFT_PART]; //last partition of output
+  long sum[FIR_FFT_LEN]; //output spectrum before it is scaled to 16 bits
+  int work[FIR_FFT_LEN];
+  int newest; //history row of the latest input spectrum
+  int fill; //samples of the current partition received
+  const firSpectra* fadeFrom; //a retune: the next partition crossfades out of these spectra, then drops them
+};
+
+void firFftDesignPart(firSpectra &spectra, int part, const int* coeffs, int count); //spectrum of one partition of up to FIR_FFT_PART taps
+void firFftDesign(firSpectra &spectra, const int* coeffs, unsigned int length); //every partition of a filter, up to FIR_FFT_TAPS_MAX taps
+void firFftReset(firFftState &state); //clears the input history and any pending crossfade
+void firFftProcess(firFftState &state, const firSpectra &spectra, int* samples, int frameSize); //filters a block in place
+void firCrossfade(int* samples, const int* old, int length); //ramps from old to samples over the block, in place
+void firFftCrossoverCommand(); //mailbox command, sets the crossover length
+
+extern firFftState firFftLeft, firFftRight;
+extern unsigned int firFftCrossover;
+
+#endif
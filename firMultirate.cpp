@@ -0,0 +1,75 @@
+#include "firMultirate.h"
+#include "firDesign.h"
+
+firMultirateState firMultirateLeft[2], firMultirateRight[2];
+
+int firMultirateValid(int factor)
+{
+  return (factor == 2) || (factor == 4) || (factor == 8);
+}
+
+int firMultirateDesign(int* aa, int factor)
+{
+  //cutoff at 3/8 of the low rate, the stopband starts at its Nyquist
+  int length = factor*FIR_MR_PHASE_TAPS + 1;
+  firDesign(aa, length, LOW_PASS, 3, 0, 8L*factor, FIR_MR_KAISER);
+  return length;
+}
+
+void firMultirateReset(firMultirateState &state, int factor)
+{
+  memset(state.input, 0, FIR_MR_AA_MAX - 1 + I2S_DMA_BUF_LEN);
+  memset(state.low, 0, FIR_MR_PHASE_TAPS + I2S_DMA_BUF_LEN/2);
+  state.factor = factor;
+  state.lowCount = 0;
+}
+
+int* firDecimate(firMultirateState &state, const int* aa, const int* samples, int frameSize)
+{
+  int length = state.factor*FIR_MR_PHASE_TAPS + 1;
+  int* x = state.input + length - 1; //x[-k] is k samples back
+  int* y = state.low + FIR_MR_PHASE_TAPS;
+  memcpy(x, samples, frameSize);
+  int count = frameSize / state.factor;
+  for(int n = 0; n < count; n++)
+  {
+    const int* newest = x + (n + 1)*state.factor - 1; //only the kept samples are computed
+    long acc = 0x4000;
+    for(int k = 0; k < length; k++)
+    {
+      acc += (long) aa[k] * newest[-k];
+    }
+    acc >>= 15;
+    y[n] = (acc > 32767) ? 32767 : ((acc < -32768) ? -32768 : acc);
+  }
+  memmove(state.input, x + frameSize - (length - 1), length - 1); //keep the last length - 1 samples
+  state.lowCount = count;
+  return y;
+}
+
+void firInterpolate(firMultirateState &state, const int* aa, int* samples, int frameSize)
+{
+  int factor = state.factor;
+  int up = (factor == 2) ? 1 : ((factor == 4) ? 2 : 3); //the stuffed zeros cost a gain of factor
+  const int* x = state.low + FIR_MR_PHASE_TAPS;
+  int count = state.lowCount;
+  if(count*factor > frameSize) //never write past the block, whatever firDecimate was given
+  {
+    count = frameSize / factor;
+  }
+  for(int n = 0; n < count; n++)
+  {
+    for(int p = 0; p < factor; p++) //phase p takes every factor'th tap from p
+    {
+      long acc = 1L << (14 - up);
+      const int* h = aa + p;
+      for(int k = 0; k <= FIR_MR_PHASE_TAPS - (p ? 1 : 0); k++)
+      {
+        acc += (long) h[k*factor] * x[n - k];
+      }
+      acc >>= 15 - up;
+      samples[n*factor + p] = (acc > 32767) ? 32767 : ((acc < -32768) ? -32768 : acc);
+    }
+  }
+  memmove(state.low, state.low + state.lowCount, FIR_MR_PHASE_TAPS);
+}
@@ -0,0 +1,37 @@
+//Polyphase multirate FIR for narrow, low cutoff filters.
+//The block is decimated by FIR_MR factor, the core filter runs at the low
+//rate, and the result is interpolated back. A core of n taps at fs/factor
+//spans as much time as factor*n taps at fs, so a 100 Hz low pass costs a
+//fraction of the multiplies of the direct form. The anti-alias and anti-image
+//filter is a Kaiser low pass, about 80 dB down, whose stopband starts at the
+//low rate's Nyquist. Both sides run polyphase: the decimator only computes the
+//samples it keeps and the interpolator never multiplies the stuffed zeros.
+//The core's band edges must sit below a quarter of the low rate, above that
+//the anti-alias filter rolls them off.
+#ifndef _FIRMULTIRATE_H_INCLUDED	//prevent multirate fir library from being invoked twice and breaking the namespace
+#define _FIRMULTIRATE_H_INCLUDED
+
+#include "core.h"
+#include "Audio_exposed.h"
+
+#define FIR_MR_FACTOR_MAX 8 //factors are 2, 4 or 8
+#define FIR_MR_PHASE_TAPS 20 //anti-alias taps per phase, the filter is factor*FIR_MR_PHASE_TAPS + 1 long
+#define FIR_MR_AA_MAX (FIR_MR_FACTOR_MAX*FIR_MR_PHASE_TAPS + 1)
+#define FIR_MR_KAISER 80 //anti-alias window, beta in tenths
+
+struct firMultirateState {
+  int input[FIR_MR_AA_MAX - 1 + I2S_DMA_BUF_LEN]; //decimator history, then the block
+  int low[FIR_MR_PHASE_TAPS + I2S_DMA_BUF_LEN/2]; //interpolator history, then the low rate block
+  int factor; //what the history was taken at
+  int lowCount; //low rate samples of the current block
+};
+
+int firMultirateValid(int factor); //1 for the supported factors
+int firMultirateDesign(int* aa, int factor); //the anti-alias filter for a factor, returns its length
+void firMultirateReset(firMultirateState &state, int factor); //clears both histories
+int* firDecimate(firMultirateState &state, const int* aa, const int* samples, int frameSize); //returns the low rate block, frameSize/factor samples
+void firInterpolate(firMultirateState &state, const int* aa, int* samples, int frameSize); //the low rate block back to frameSize samples
+
+extern firMultirateState firMultirateLeft[2], firMultirateRight[2]; //a pair per channel, like the delay lines
+
+#endif
@@ -0,0 +1,138 @@
+#include "firNlms.h"
+#include "paramBank.h"
+
+firNlmsState firNlmsLeft;
+int nlmsEstimate[FIR_NLMS_BLOCK]; //the reference as the filter shapes it
+
+void firNlmsConfigInit(firNlmsConfig &config)
+{
+  config.taps = 0;
+  config.mu = FIR_NLMS_MU_DEFAULT;
+  config.leak = 0;
+  config.frozen = 0;
+  config.restart = 0;
+}
+
+void firNlmsReset(firNlmsState &state, unsigned int taps, unsigned int restart)
+{
+  for(unsigned int k = 0; k < FIR_NLMS_TAPS_MAX; k++)
+  {
+    state.weights[k] = 0;
+    state.coeffs[k] = 0;
+  }
+  memset(state.delay, 0, taps + 2);
+  memset(state.history, 0, taps - 1);
+  state.taps = taps;
+  state.restart = restart;
+}
+
+//moves every tap along the mean correlation of the error with the reference.
+//Both are taken at every FIR_NLMS_STRIDE'th sample; the products are averaged as
+//they are summed, so the 32 bit sum can't wrap. The step, mu/(taps*power), is
+//kept as a Q15 mantissa and a shift.
+void firNlmsUpdate(firNlmsState &state, const firNlmsConfig &config, const int* error, const int* x, int frameSize)
+{
+  unsigned int taps = state.taps;
+  int count = frameSize / FIR_NLMS_STRIDE;
+  int shift = 0;
+  while((1 << shift) < count)
+  {
+    shift++;
+  }
+  long power = 0;
+  for(int n = FIR_NLMS_STRIDE - 1; n < frameSize; n += FIR_NLMS_STRIDE)
+  {
+    power += ((long) x[n] * x[n]) >> shift;
+  }
+  int t = 0; //power and correlation are scaled down alike to 15 bits
+  while((power >> t) >= 32768L)
+  {
+    t++;
+  }
+  long den = (long) taps * ((power >> t) + (FIR_NLMS_FLOOR >> t) + 1);
+  int u = 0;
+  while(den >= 32768L)
+  {
+    den >>= 1;
+    u++;
+  }
+  while(den < 16384)
+  {
+    den <<= 1;
+    u--;
+  }
+  long step = ((long) config.mu << 15) / den;
+  int stepShift = 15 + u - 8; //to Q23
+  if(stepShift < 0)
+  {
+    stepShift = 0;
+  }
+  for(unsigned int k = 0; k < taps; k++)
+  {
+    long g = 0;
+    for(int n = FIR_NLMS_STRIDE - 1; n < frameSize; n += FIR_NLMS_STRIDE)
+    {
+      g += ((long) error[n] * x[n - (int) k]) >> shift;
+    }
+    g >>= t;
+    g = (g > FIR_NLMS_GRAD_MAX) ? FIR_NLMS_GRAD_MAX : ((g < -FIR_NLMS_GRAD_MAX) ? -FIR_NLMS_GRAD_MAX : g);
+    long w = state.weights[k];
+    w += (g * step) >> stepShift;
+    w -= (((w >> 8) * config.leak) >> 7);
+    w = (w > FIR_NLMS_WEIGHT_MAX) ? FIR_NLMS_WEIGHT_MAX : ((w < FIR_NLMS_WEIGHT_MIN) ? FIR_NLMS_WEIGHT_MIN : w);
+    state.weights[k] = w;
+    w = (w + 128) >> 8;
+    state.coeffs[k] = (w > 32767) ? 32767 : w;
+  }
+}
+
+void firNlmsProcess(firNlmsState &state, const firNlmsConfig &config, int* primary, int* reference, int frameSize)
+{
+  unsigned int taps = state.taps;
+  int* x = state.history + taps - 1; //x[-k] is k samples back
+  memcpy(x, reference, frameSize);
+  for(int start = 0; start < frameSize; start += FIR_NLMS_BLOCK) //the taps move every FIR_NLMS_BLOCK samples whatever the ring block
+  {
+    int length = (frameSize - start < FIR_NLMS_BLOCK) ? frameSize - start : FIR_NLMS_BLOCK;
+    filter_fir(x + start, state.coeffs, nlmsEstimate, state.delay, length, taps);
+    for(int n = 0; n < length; n++)
+    {
+      long e = (long) primary[start + n] - nlmsEstimate[n];
+      primary[start + n] = (e > 32767) ? 32767 : ((e < -32768) ? -32768 : e);
+    }
+    if(!config.frozen)
+    {
+      firNlmsUpdate(state, config, primary + start, x + start, length);
+    }
+  }
+  memmove(state.history, x + frameSize - (taps - 1), taps - 1);
+}
+
+void firNlmsModeCommand()
+{
+  //syntax is: <int command><int channel><int taps>, 0 turns the canceller off
+  unsigned int taps = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  stageParams &params = paramEdit(audioParams);
+  params.nlms.taps = (taps > FIR_NLMS_TAPS_MAX) ? FIR_NLMS_TAPS_MAX : taps;
+  params.nlms.restart++;
+}
+
+void firNlmsStepCommand()
+{
+  //syntax is: <int command><int channel><int mu>, Q15
+  int mu = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  paramEdit(audioParams).nlms.mu = (mu < 0) ? 0 : mu;
+}
+
+void firNlmsLeakCommand()
+{
+  //syntax is: <int command><int channel><int leak>, Q15 per block
+  int leak = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  paramEdit(audioParams).nlms.leak = (leak < 0) ? 0 : leak;
+}
+
+void firNlmsFreezeCommand()
+{
+  //syntax is: <int command><int channel><int frozen>, 1 holds the taps, 0 adapts again
+  paramEdit(audioParams).nlms.frozen = ((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]) != 0;
+}
@@ -0,0 +1,61 @@
+//Adaptive FIR noise canceller, a normalised LMS filter in the FIR slot.
+//The left input is the primary, signal plus noise, and the right input a
+//reference that only picks up the noise. The filter shapes the reference into
+//the noise as the primary hears it and the left output is what is left over,
+//the error. The right channel passes through.
+//The taps move once every FIR_NLMS_BLOCK samples: filter_fir runs those with
+//the current taps on the left channel's FIR delay line, then every tap steps
+//along the mean correlation of the error with the reference, normalised by
+//the reference power. The correlation takes every FIR_NLMS_STRIDE'th sample,
+//so a sample takes about 1 + 1/FIR_NLMS_STRIDE times the multiplies of a
+//plain filter_fir of the same length.
+//The weights are running state, like the delay lines; the banked configuration
+//only holds what the commands set.
+#ifndef _FIRNLMS_H_INCLUDED	//prevent nlms library from being invoked twice and breaking the namespace
+#define _FIRNLMS_H_INCLUDED
+
+#include "core.h"
+#include "filter.h"
+#include "mailbox.h"
+#include "Audio_exposed.h"
+
+#define FIR_NLMS_TAPS_MAX 511 //FILTER_LENGTH_MAX, the FIR delay lines are sized for it
+#define FIR_NLMS_BLOCK 64 //samples per update, the shortest ring block
+#define FIR_NLMS_STRIDE 4 //block samples per correlation sample
+#define FIR_NLMS_MU_DEFAULT 3277 //0.1, Q15. Larger steps converge faster and settle higher
+#define FIR_NLMS_FLOOR 64 //reference mean square below which the step stops growing
+#define FIR_NLMS_GRAD_MAX 16384 //the normalised correlation is clamped here, a step moves a tap by mu/taps at most
+#define FIR_NLMS_WEIGHT_MAX (32767L << 8) //a weight holds its tap in Q15 with 8 more bits below
+#define FIR_NLMS_WEIGHT_MIN (-(32768L << 8))
+
+struct firNlmsConfig {
+  unsigned int taps; //0: off, the FIR stage runs the coefficient sets
+  int mu; //normalised step size, Q15
+  int leak; //the taps shrink by this fraction every block, Q15
+  int frozen; //keep filtering with the taps as they are
+  unsigned int restart; //bumped by the mode command, the weights start again from zero
+};
+
+struct firNlmsState {
+  long weights[FIR_NLMS_TAPS_MAX]; //Q23, so small steps aren't lost
+  int coeffs[FIR_NLMS_TAPS_MAX]; //the weights rounded to Q15, what filter_fir runs
+  unsigned int taps;
+  unsigned int restart; //the config's restart the weights were cleared for
+  int running; //the pipeline compiled it in, the delay lines are its own
+  int* delay; //filter_fir delay line, the left channel's FIR delay
+  int* history; //the reference, taps - 1 samples back and then the block; the left channel's other FIR delay
+  firNlmsConfig* config; //in the live bank
+};
+
+void firNlmsConfigInit(firNlmsConfig &config);
+void firNlmsReset(firNlmsState &state, unsigned int taps, unsigned int restart); //zero weights and history
+void firNlmsProcess(firNlmsState &state, const firNlmsConfig &config, int* primary, int* reference, int frameSize); //primary becomes the error, in place
+
+void firNlmsModeCommand(); //<int command><int channel><int taps>
+void firNlmsStepCommand(); //<int command><int channel><int mu>
+void firNlmsLeakCommand(); //<int command><int channel><int leak>
+void firNlmsFreezeCommand(); //<int command><int channel><int frozen>
+
+extern firNlmsState firNlmsLeft;
+
+#endif
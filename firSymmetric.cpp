@@ -0,0 +1,98 @@
+#include <DSPLIB.h>
+#include "firSymmetric.h"
+#include "filter.h"
+#include "paramBank.h"
+
+unsigned int firSymmetricMin[2] = {FILTER_LENGTH_MAX + 1, FILTER_LENGTH_MAX + 1}; //filter_fir until setup has timed them
+
+int firIsSymmetric(const int* coeffs, unsigned int length)
+{
+  if(length < 2)
+  {
+    return 0;
+  }
+  long gain = 0;
+  for(unsigned int k = 0; k < length/2; k++)
+  {
+    if(coeffs[k] != coeffs[length - 1 - k])
+    {
+      return 0;
+    }
+    gain += 2*labs((long) coeffs[k]);
+  }
+  if(length & 1) //firs sums in 40 bits, the odd kernel in 32
+  {
+    gain += labs((long) coeffs[length/2]);
+    return gain <= FIR_SYMMETRIC_GAIN_MAX;
+  }
+  return 1;
+}
+
+//odd lengths: the newest and oldest sample of the window meet the first tap,
+//the centre one is multiplied alone. The line holds the last length - 1 inputs
+//and the block after them, so a window never wraps.
+void firSymmetricOdd(int* samples, const int* coeffs, int* delay, int frameSize, unsigned int length)
+{
+  unsigned int half = length/2;
+  memcpy(delay + length - 1, samples, frameSize);
+  for(int i = 0; i < frameSize; i++)
+  {
+    const int* newest = delay + i + length - 1;
+    const int* oldest = delay + i;
+    long acc = 0x4000L + (long) coeffs[half]*oldest[half];
+    for(unsigned int k = 0; k < half; k++)
+    {
+      acc += (long) coeffs[k]*((long) *newest-- + *oldest++);
+    }
+    acc >>= 15;
+    samples[i] = (acc > 32767) ? 32767 : ((acc < -32768) ? -32768 : acc);
+  }
+  memmove(delay, delay + frameSize, length - 1);
+}
+
+void firSymmetricFilter(int* samples, int* coeffs, int* dbuffer, int frameSize, unsigned int length)
+{
+  if(length & 1)
+  {
+    firSymmetricOdd(samples, coeffs, dbuffer, frameSize, length);
+  }
+  else
+  {
+    firs((DATA*) samples, (DATA*) coeffs, (DATA*) samples, (DATA*) dbuffer, frameSize, length/2);
+  }
+}
+
+//microseconds one block of length taps takes, on silence, folded or with filter_fir.
+unsigned long firSymmetricTime(int* coeffs, int* samples, int* delay, unsigned int length, int folded)
+{
+  memset(delay, 0, FIR_DELAY_LEN);
+  unsigned long start = micros();
+  if(folded)
+  {
+    firSymmetricFilter(samples, coeffs, delay, FIR_SYMMETRIC_BENCH, length);
+  }
+  else
+  {
+    filter_fir((DATA*) samples, (DATA*) coeffs, (DATA*) samples, (DATA*) delay, FIR_SYMMETRIC_BENCH, length);
+  }
+  return micros() - start;
+}
+
+void firSymmetricCalibrate(int* coeffs, int* samples, int* delay)
+{
+  memset(coeffs, 0, FILTER_LENGTH_MAX);
+  memset(samples, 0, FIR_SYMMETRIC_BENCH);
+  //from the longest length of each parity down, folding takes every length it still wins at.
+  for(unsigned int odd = 0; odd < 2; odd++)
+  {
+    firSymmetricMin[odd] = FILTER_LENGTH_MAX + 1;
+    for(unsigned int length = FILTER_LENGTH_MAX - 1 + odd; length >= FIR_SYMMETRIC_MIN_LEN; length = ((length/2) & ~1u) + odd)
+    {
+      if(firSymmetricTime(coeffs, samples, delay, length, 1) >= firSymmetricTime(coeffs, samples, delay, length, 0))
+      {
+        break;
+      }
+      firSymmetricMin[odd] = length;
+    }
+  }
+}
@@ -0,0 +1,35 @@
+//Linear phase FIR filters, folded around their centre.
+//When the taps mirror around the centre, h[k] == h[nh-1-k], the two samples
+//that meet the same tap are added before the multiply, halving the multiplies.
+//Even lengths go to DSPLIB's symmetric kernel, firs, which is handed only the
+//first half of the taps. firs can't centre a filter on a sample, so the odd
+//lengths firDesign makes and the SD tables hold run a folded loop of our own,
+//with the centre tap added on its own.
+//Whether folding wins over filter_fir's dual MAC depends on the device, so
+//setup times both kernels on the C55x itself and only sets of at least
+//firSymmetricMin taps, per parity, are folded.
+//An even length keeps the library's delay line: length + 2 words, 32 bit
+//aligned, the first word the index of the oldest sample, the same as
+//filter_fir's. An odd length keeps its last length - 1 inputs at the start of
+//the line, followed by the block; all zeros is silence in either layout.
+#ifndef _FIRSYMMETRIC_H_INCLUDED	//prevent symmetric fir library from being invoked twice and breaking the namespace
+#define _FIRSYMMETRIC_H_INCLUDED
+
+#include "core.h"
+
+#define FIR_SYMMETRIC_BENCH 256 //samples a calibration run times
+#define FIR_SYMMETRIC_MIN_LEN 16 //shortest set calibration tries
+#define FIR_SYMMETRIC_GAIN_MAX 65535L //Q15 sum of the taps' magnitudes an odd set's 32 bit sums can take
+
+int firIsSymmetric(const int* coeffs, unsigned int length); //1 if the set can be folded
+void firSymmetricFilter(int* samples, int* coeffs, int* dbuffer, int frameSize, unsigned int length); //filters a block in place, dbuffer is length + 2 words, or length - 1 + frameSize for an odd length
+void firSymmetricCalibrate(int* coeffs, int* samples, int* delay); //setup, before the DMA starts: times folding against filter_fir on scratch buffers of FIR_DELAY_LEN words and sets firSymmetricMin
+
+extern unsigned int firSymmetricMin[2]; //shortest symmetric set that is folded, by length & 1; past FILTER_LENGTH_MAX if folding never won
+
+inline int firSymmetricFolds(unsigned int length)
+{
+  return length >= firSymmetricMin[length & 1];
+}
+
+#endif
@@ -0,0 +1,437 @@
+#include "iirDesign.h"
+
+#define IIR_PI 3.14159265f
+#define IIR_SECTIONS_MAX (IIR_ORDER_MAX/2)
+#define IIR_LANDEN_END 1e-8f //a modulus this small no longer moves a float
+#define IIR_ROOT_END 1e-6f //the Bessel zeros have settled once none moves further than this
+
+//one conjugate pole pair of the analog prototype, pass band edge at 1 rad/s:
+//s^2 + d1*s + d0 over s^2 + zero^2, or over 1 when zero is 0.
+struct iirPair {
+  float d1;
+  float d0;
+  float zero;
+};
+
+//normalised Bessel pairs of the orders designed so far: order 2*h keeps its h pairs from h*(h - 1)/2 on.
+iirPair besselTable[IIR_SECTIONS_MAX*(IIR_SECTIONS_MAX + 1)/2];
+int besselKnown[IIR_SECTIONS_MAX + 1]; //1 once order 2*h is in the table
+
+struct iirComplex {
+  float re;
+  float im;
+};
+
+inline iirComplex cMake(float re, float im)
+{
+  iirComplex c;
+  c.re = re;
+  c.im = im;
+  return c;
+}
+
+inline iirComplex cAdd(iirComplex a, iirComplex b)
+{
+  return cMake(a.re + b.re, a.im + b.im);
+}
+
+inline iirComplex cSub(iirComplex a, iirComplex b)
+{
+  return cMake(a.re - b.re, a.im - b.im);
+}
+
+inline iirComplex cMul(iirComplex a, iirComplex b)
+{
+  return cMake(a.re*b.re - a.im*b.im, a.re*b.im + a.im*b.re);
+}
+
+inline iirComplex cDiv(iirComplex a, iirComplex b)
+{
+  float d = b.re*b.re + b.im*b.im;
+  return cMake((a.re*b.re + a.im*b.im)/d, (a.im*b.re - a.re*b.im)/d);
+}
+
+inline long iirRound(float x)
+{
+  return (long) floor(x + 0.5f);
+}
+
+void butterPairs(iirPair* pairs, int order)
+{
+  for(int i = 0; i < order/2; i++)
+  {
+    float theta = IIR_PI*(2*i + 1)/(2*order);
+    pairs[i].d1 = 2*sin(theta);
+    pairs[i].d0 = 1;
+    pairs[i].zero = 0;
+  }
+}
+
+void chebyPairs(iirPair* pairs, int order)
+{
+  float inverse = 1/sqrt(pow(10.0f, IIR_RIPPLE_DB/10) - 1); //1/epsilon
+  float mu = log(inverse + sqrt(inverse*inverse + 1))/order; //asinh(1/epsilon)/order
+  float sinhMu = (exp(mu) - exp(-mu))/2;
+  float coshMu = (exp(mu) + exp(-mu))/2;
+  for(int i = 0; i < order/2; i++)
+  {
+    float theta = IIR_PI*(2*i + 1)/(2*order);
+    float re = sinhMu*sin(theta);
+    float im = coshMu*cos(theta);
+    pairs[i].d1 = 2*re;
+    pairs[i].d0 = re*re + im*im;
+    pairs[i].zero = 0;
+  }
+}
+
+//log(1/|H(jw)|^2) of an all pole cascade of unity gain at DC
+float besselLoss(const iirPair* pairs, int half, float w)
+{
+  float loss = 0;
+  for(int i = 0; i < half; i++)
+  {
+    float re = pairs[i].d0 - w*w, im = pairs[i].d1*w;
+    loss += log((re*re + im*im)/(pairs[i].d0*pairs[i].d0));
+  }
+  return loss;
+}
+
+//Bessel poles from the reverse Bessel polynomial's differential equation,
+//s*y'' - 2*(s + n)*y' + 2*n*y = 0. At each zero it gives
+//sum(1/(s_k - s_j), j != k) = 1 + n/s_k, which only takes differences of the
+//zeros. Evaluating the polynomial instead loses the zeros near the real axis to
+//float cancellation past order 12.
+//The zeros are taken as t = s/c, c the geometric mean of their moduli, which keeps
+//them near the unit circle. Newton steps walk the upper half zeros, their conjugates
+//taken as given, then the pairs are scaled to -3 dB at 1 rad/s.
+//Returns 0 if they do not settle.
+int besselSolve(iirPair* pairs, int order)
+{
+  int half = order/2;
+  iirComplex roots[IIR_SECTIONS_MAX];
+  float logC = -order*log(2.0f);
+  for(int i = order + 1; i <= 2*order; i++) //the constant term is (2n)!/(2^n n!)
+  {
+    logC += log((float) i);
+  }
+  float c = exp(logC/order);
+
+  //start from Campos and Calderon's approximation of the zeros of x^n*y(1/x)
+  float n = order;
+  float norm = n*n*(2 - 3*n*n + n*n*n);
+  float b0 = n*(-6 + 5*n*n - n*n*n)/norm;
+  float b1 = (8 + 24*n - 12*n*n - 2*n*n*n)/norm;
+  float b2 = (-24 - 12*n + 12*n*n)/norm;
+  float b3 = (16 - 8*n)/norm;
+  float a1 = (-6 - 6*n)/(n*n*(2 + n));
+  float a2 = 6/(n*n*(2 + n));
+  for(int i = 0; i < half; i++) //the lower half of x gives the upper half of t = 1/(c*x)
+  {
+    float k = i + 1;
+    iirComplex x = cMake(c*(a1*k + a2*k*k), c*(b0 + k*(b1 + k*(b2 + k*b3))));
+    roots[i] = cDiv(cMake(1, 0), x);
+  }
+
+  int settled = 0;
+  for(int pass = 0; (pass < IIR_ROOT_PASSES) && !settled; pass++)
+  {
+    settled = 1;
+    for(int i = 0; i < half; i++)
+    {
+      //f = sum(1/(t_i - t_j)) - c - n/t_i, f' = -sum(1/(t_i - t_j)^2) + n/t_i^2
+      iirComplex inverse = cDiv(cMake(1, 0), roots[i]);
+      iirComplex f = cMake(-c - n*inverse.re, -n*inverse.im);
+      iirComplex slope = cMul(cMake(n*inverse.re, n*inverse.im), inverse);
+      for(int j = 0; j < half; j++)
+      {
+        iirComplex term = cDiv(cMake(1, 0), cSub(roots[i], cMake(roots[j].re, -roots[j].im)));
+        f = cAdd(f, term);
+        slope = cSub(slope, cMul(term, term));
+        if(j != i)
+        {
+          term = cDiv(cMake(1, 0), cSub(roots[i], roots[j]));
+          f = cAdd(f, term);
+          slope = cSub(slope, cMul(term, term));
+        }
+      }
+      iirComplex step = cDiv(f, slope);
+      roots[i] = cSub(roots[i], step);
+      if(step.re*step.re + step.im*step.im > IIR_ROOT_END*IIR_ROOT_END)
+      {
+        settled = 0;
+      }
+    }
+  }
+  if(!settled)
+  {
+    return 0;
+  }
+  for(int i = 0; i < half; i++)
+  {
+    if(!(roots[i].re < 0) || !(roots[i].im > 0))
+    {
+      return 0;
+    }
+    pairs[i].d1 = -2*roots[i].re;
+    pairs[i].d0 = roots[i].re*roots[i].re + roots[i].im*roots[i].im;
+    pairs[i].zero = 0;
+  }
+  //-3 dB point: the loss rises with w, bisect it for log(2)
+  float low = 0, high = 1;
+  while(besselLoss(pairs, half, high) < log(2.0f))
+  {
+    low = high;
+    high *= 2;
+  }
+  for(int b = 0; b < 24; b++)
+  {
+    float w = (low + high)/2;
+    if(besselLoss(pairs, half, w) > log(2.0f))
+    {
+      high = w;
+    }
+    else
+    {
+      low = w;
+    }
+  }
+  float w3 = (low + high)/2;
+  for(int i = 0; i < half; i++)
+  {
+    pairs[i].d1 /= w3;
+    pairs[i].d0 /= w3*w3;
+  }
+  return 1;
+}
+
+//the Bessel pairs only depend on the order, so each order is solved once and a
+//retune only runs the bilinear transform.
+int besselPairs(iirPair* pairs, int order)
+{
+  int half = order/2;
+  iirPair* known = besselTable + half*(half - 1)/2;
+  if(!besselKnown[half])
+  {
+    if(!besselSolve(known, order))
+    {
+      return 0;
+    }
+    besselKnown[half] = 1;
+  }
+  for(int i = 0; i < half; i++)
+  {
+    pairs[i] = known[i];
+  }
+  return 1;
+}
+
+//descending Landen moduli of k, kp its complement. Each step is taken the way that
+//keeps its precision, (k/(1 + kp))^2 for a small modulus and (1 - kp)/(1 + kp) near 1.
+int landen(float* v, float k, float kp)
+{
+  int n = 0;
+  while(n < IIR_LANDEN_MAX)
+  {
+    float next = (k < 0.7f) ? (k/(1 + kp))*(k/(1 + kp)) : (1 - kp)/(1 + kp);
+    kp = 2*sqrt(kp)/(1 + kp);
+    k = next;
+    v[n++] = k;
+    if(k < IIR_LANDEN_END)
+    {
+      break;
+    }
+  }
+  return n;
+}
+
+//cd(u*K, k) for real u, or sn when sine is set, by ascending the Landen moduli.
+float ellipCd(float u, const float* v, int steps, int sine)
+{
+  float w = sine ? sin(u*IIR_PI/2) : cos(u*IIR_PI/2);
+  for(int n = steps - 1; n >= 0; n--)
+  {
+    w = (1 + v[n])*w/(1 + v[n]*w*w);
+  }
+  return w;
+}
+
+//elliptic pairs after Orfanidis: the selectivity k from the degree equation, zeros at
+//1/(k*cd(u)) and poles at j*cd(u - j*v0), u = (2i - 1)/order. Returns 0 when k rounds to 1.
+int ellipPairs(iirPair* pairs, int order)
+{
+  int half = order/2;
+  float v[IIR_LANDEN_MAX], v1[IIR_LANDEN_MAX];
+  float ep = sqrt(pow(10.0f, IIR_RIPPLE_DB/10) - 1);
+  float es = sqrt(pow(10.0f, IIR_STOP_DB/10) - 1);
+  float k1 = ep/es, k1p = sqrt(1 - k1*k1);
+
+  //degree equation: k' = k1'^order * prod(sn(u_i, k1'))^4
+  int steps = landen(v, k1p, k1);
+  float kp = pow(k1p, (float) order);
+  for(int i = 1; i <= half; i++)
+  {
+    float sn = ellipCd((float)(2*i - 1)/order, v, steps, 1);
+    kp *= sn*sn*sn*sn;
+  }
+  if(!(kp > 0) || !(kp < 1))
+  {
+    return 0;
+  }
+  float k = sqrt(1 - kp*kp);
+  steps = landen(v, k, kp);
+  if(v[steps - 1] >= IIR_LANDEN_END)
+  {
+    return 0;
+  }
+
+  //v0 = asne(j/ep, k1)/(j*order), along the imaginary axis where acde stays real
+  int steps1 = landen(v1, k1, k1p);
+  float y = 1/ep;
+  for(int n = 0; n < steps1; n++)
+  {
+    float before = n ? v1[n - 1] : k1;
+    y = y/(1 + sqrt(1 + y*y*before*before))*2/(1 + v1[n]);
+  }
+  float v0 = 2/IIR_PI*log(y + sqrt(y*y + 1))/order;
+
+  float a = v0*IIR_PI/2;
+  float coshB = (exp(a) + exp(-a))/2, sinhB = (exp(a) - exp(-a))/2;
+  for(int i = 0; i < half; i++)
+  {
+    float u = (float)(2*i + 1)/order;
+    pairs[i].zero = 1/(k*ellipCd(u, v, steps, 0));
+    iirComplex w = cMake(cos(u*IIR_PI/2)*coshB, sin(u*IIR_PI/2)*sinhB); //cos((u - j*v0)*pi/2)
+    for(int n = steps - 1; n >= 0; n--)
+    {
+      iirComplex lift = cMake(1 + v[n], 0);
+      iirComplex den = cAdd(cMake(1, 0), cMul(cMake(v[n], 0), cMul(w, w)));
+      w = cDiv(cMul(lift, w), den);
+    }
+    //pole = j*w
+    pairs[i].d1 = 2*w.im;
+    pairs[i].d0 = w.re*w.re + w.im*w.im;
+    if(!(pairs[i].d1 > 0))
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int iirDesign(int* coeffs, int order, int type, int pass, long hz, long fs)
+{
+  if((order < 2) || (order > IIR_ORDER_MAX) || (order % 2) || (hz <= 0) || (fs <= 0) || ((pass != LOW_PASS) && (pass != HIGH_PASS)))
+  {
+    return 0;
+  }
+  if((type == TYPE_ELLIP) && (order > IIR_ELLIP_ORDER_MAX))
+  {
+    return 0;
+  }
+  iirPair pairs[IIR_SECTIONS_MAX];
+  int half = order/2;
+  float level = 1;
+  if(type == TYPE_BUTTER)
+  {
+    butterPairs(pairs, order);
+  }
+  else if(type == TYPE_BESSEL)
+  {
+    if(!besselPairs(pairs, order))
+    {
+      return 0;
+    }
+  }
+  else if(type == TYPE_CHEBY)
+  {
+    chebyPairs(pairs, order);
+    level = pow(10.0f, -IIR_RIPPLE_DB/20);
+  }
+  else if(type == TYPE_ELLIP)
+  {
+    if(!ellipPairs(pairs, order))
+    {
+      return 0;
+    }
+    level = pow(10.0f, -IIR_RIPPLE_DB/20);
+  }
+  else
+  {
+    return 0;
+  }
+
+  //lowest Q first, Q = sqrt(d0)/d1
+  for(int i = 1; i < half; i++)
+  {
+    iirPair pair = pairs[i];
+    int j = i;
+    for(; (j > 0) && (pairs[j - 1].d1*pairs[j - 1].d1*pair.d0 < pair.d1*pair.d1*pairs[j - 1].d0); j--)
+    {
+      pairs[j] = pairs[j - 1];
+    }
+    pairs[j] = pair;
+  }
+
+  float edge = (float) hz/fs;
+  if(edge > IIR_EDGE_MAX)
+  {
+    edge = IIR_EDGE_MAX;
+  }
+  float wc = tan(IIR_PI*edge); //bilinear prewarp, s = (1 - 1/z)/(1 + 1/z)
+  int sign = (pass == HIGH_PASS) ? -1 : 1; //centre of the pass band, z = 1 or z = -1
+  int design[COEFFS_PER_BIQUAD*IIR_SECTIONS_MAX];
+  for(int i = 0; i < half; i++)
+  {
+    //analog section c2*s^2 + c1*s + c0 at the cutoff, s -> s/wc or s -> wc/s
+    float c0, c1 = pairs[i].d1*wc, c2;
+    float beta = 2*sign; //numerator 1 + beta/z + 1/z^2, zeros at z = -sign
+    if(pass == LOW_PASS)
+    {
+      c0 = pairs[i].d0*wc*wc;
+      c2 = 1;
+      if(pairs[i].zero > 0)
+      {
+        float z = pairs[i].zero*pairs[i].zero*wc*wc;
+        beta = 2*(z - 1)/(z + 1);
+      }
+    }
+    else
+    {
+      c0 = wc*wc;
+      c2 = pairs[i].d0;
+      if(pairs[i].zero > 0)
+      {
+        float z = pairs[i].zero*pairs[i].zero;
+        beta = 2*(c0 - z)/(c0 + z);
+      }
+    }
+    float norm = c0 + c1 + c2;
+    long a1 = iirRound(2*(c0 - c2)/norm*16384);
+    long a2 = iirRound((c0 - c1 + c2)/norm*16384);
+    if((a2 >= 16384) || (a2 <= -16384) || (a1 >= 16384 + a2) || (-a1 >= 16384 + a2) || (a1 < -32768) || (a1 > 32767))
+    {
+      return 0; //a pole on or past the unit circle once rounded
+    }
+    //numerator gain from the rounded denominator: unity at the centre, rounded up, and the scale takes the excess
+    long centre = 16384 + sign*a1 + a2;
+    float zeroSum = 2 + sign*beta;
+    long b0 = (long) ceil(centre/zeroSum);
+    long b1 = (beta == 2*sign) ? 2*sign*b0 : iirRound(beta*b0);
+    long gain = 2*b0 + sign*b1;
+    if((b0 < 1) || (b0 > 32767) || (b1 < -32768) || (b1 > 32767) || (gain <= 0))
+    {
+      return 0;
+    }
+    long scale = iirRound((i ? 1 : level)*centre/gain*32768);
+    int* c = design + COEFFS_PER_BIQUAD*i;
+    c[0] = b0;
+    c[1] = b1;
+    c[2] = b0;
+    c[3] = 16384;
+    c[4] = a1;
+    c[5] = a2;
+    c[6] = (scale > 32767) ? 32767 : scale;
+  }
+  memcpy(coeffs, design, half*COEFFS_PER_BIQUAD);
+  return 1;
+}
@@ -0,0 +1,39 @@
+//IIR design on the device, for any cutoff, in place of the iir/<type>/<pass>/<order>.iir tables.
+//The analog prototype's poles, and zeros for elliptic filters, are found in
+//float. Each conjugate pair becomes a biquad through the bilinear transform,
+//prewarped to the cutoff, and is rounded to the 7 word layout of
+//filter_iirArbitraryOrder: b0 b1 b2 in Q14, a0 of 16384, a1 a2 in Q14 and an
+//output scale in Q15.
+//Sections run from the lowest Q to the highest, so the resonant ones get a
+//signal the gentler ones have already band limited. Each section's gain at the
+//centre of its pass band, DC for a low pass and Nyquist for a high pass, is
+//fixed from its rounded denominator, so rounding does not move the pass band
+//level. Chebyshev and elliptic ripple sits under 0 dB; the first section's
+//scale takes it. The stop band end keeps its exact zeros.
+//The Bessel poles don't depend on the cutoff. Their Newton search runs once per
+//order and is kept, a retune is the bilinear transform alone.
+//Float only runs while designing, never per sample; shieldSim -J times each
+//design and compares it with a double precision one.
+#ifndef _IIRDESIGN_H_INCLUDED	//prevent iir design library from being invoked twice and breaking the namespace
+#define _IIRDESIGN_H_INCLUDED
+
+#include "core.h"
+#include "filterIir.h"
+
+#define IIR_RIPPLE_DB 0.5 //pass band ripple of TYPE_CHEBY and TYPE_ELLIP
+#define IIR_STOP_DB 60.0 //stop band attenuation of TYPE_ELLIP
+#define IIR_EDGE_MAX 0.475 //highest cutoff, as a fraction of the sampling rate
+#define IIR_LANDEN_MAX 12 //descending Landen steps of the elliptic functions
+#define IIR_ROOT_PASSES 100 //Newton passes over the Bessel poles, order 40 settles in under 90
+#define IIR_ELLIP_ORDER_MAX 18 //past it the selectivity rounds to 1 in float, or most cutoffs round a pole onto the unit circle
+
+//designs an order long cascade into coeffs, order/2 sections of COEFFS_PER_BIQUAD words.
+//type is TYPE_BUTTER, TYPE_BESSEL, TYPE_CHEBY or TYPE_ELLIP, pass is LOW_PASS or
+//HIGH_PASS at hz, with sampling rate fs. Bessel filters are -3 dB at hz, Chebyshev and
+//elliptic ones leave their ripple band there.
+//order must be even, from 2 to IIR_ORDER_MAX, and elliptic ones up to IIR_ELLIP_ORDER_MAX.
+//Returns 0 and leaves coeffs alone when it is not, or when a section would be unstable once
+//rounded, as very high orders and Q get.
+int iirDesign(int* coeffs, int order, int type, int pass, long hz, long fs);
+
+#endif
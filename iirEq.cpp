@@ -0,0 +1,220 @@
+#include "iirEq.h"
+#include "iirDesign.h"
+#include "paramBank.h"
+#include "blockRing.h"
+#include "logRing.h"
+
+#define EQ_PI 3.14159265f
+
+eqState eqStateLeft, eqStateRight;
+
+void eqChannelInit(eqChannel &eq)
+{
+  for(int b = 0; b < EQ_BANDS_MAX; b++)
+  {
+    eq.band[b].type = EQ_PEAK;
+    eq.band[b].hz = 1000;
+    eq.band[b].q = 100;
+    eq.band[b].gain = 0;
+    eq.band[b].enabled = 0;
+    eq.band[b].designed = 0;
+  }
+  eq.count = 0;
+}
+
+inline long eqRound(float x)
+{
+  return (long) floor(x + 0.5f);
+}
+
+int eqDesign(int* coeffs, int type, long hz, int q, int gain, long fs)
+{
+  if((type < EQ_PEAK) || (type > EQ_NOTCH) || (hz <= 0) || (fs <= 0) || (q < EQ_Q_MIN) || (q > EQ_Q_MAX) || (gain > EQ_GAIN_MAX) || (gain < -EQ_GAIN_MAX))
+  {
+    return 0;
+  }
+  float edge = (float) hz/fs;
+  if(edge > IIR_EDGE_MAX)
+  {
+    edge = IIR_EDGE_MAX;
+  }
+  float cosW = cos(2*EQ_PI*edge);
+  float alpha = sin(2*EQ_PI*edge)*50/q; //sin(w)/2Q
+  float A = pow(10.0f, gain/400.0f); //square root of the linear gain
+  float shelf = 2*sqrt(A)*alpha;
+  float b0, a0, a1, a2; //b1 and b2 follow from b0 and the end gains
+  float dc = 1, nyquist = 1; //linear gains at the ends of the band
+  if(type == EQ_PEAK)
+  {
+    b0 = 1 + alpha*A;
+    a0 = 1 + alpha/A;
+    a1 = -2*cosW;
+    a2 = 1 - alpha/A;
+  }
+  else if(type == EQ_LOW_SHELF)
+  {
+    b0 = A*((A + 1) - (A - 1)*cosW + shelf);
+    a0 = (A + 1) + (A - 1)*cosW + shelf;
+    a1 = -2*((A - 1) + (A + 1)*cosW);
+    a2 = (A + 1) + (A - 1)*cosW - shelf;
+    dc = A*A;
+  }
+  else if(type == EQ_HIGH_SHELF)
+  {
+    b0 = A*((A + 1) + (A - 1)*cosW + shelf);
+    a0 = (A + 1) - (A - 1)*cosW + shelf;
+    a1 = 2*((A - 1) - (A + 1)*cosW);
+    a2 = (A + 1) - (A - 1)*cosW - shelf;
+    nyquist = A*A;
+  }
+  else
+  {
+    b0 = 1;
+    a0 = 1 + alpha;
+    a1 = -2*cosW;
+    a2 = 1 - alpha;
+  }
+  long c[COEFFS_PER_BIQUAD];
+  c[3] = 16384;
+  c[4] = eqRound(a1/a0*16384);
+  c[5] = eqRound(a2/a0*16384);
+  c[6] = 32767;
+  //as iirDesign does, the numerator is fitted to the rounded denominator so the gains at DC
+  //and Nyquist come out exact: b0 + b1 + b2 = dc*(a0 + a1 + a2), b0 - b1 + b2 = nyquist*(a0 - a1 + a2)
+  float sum = dc*(16384 + c[4] + c[5]);
+  float alt = nyquist*(16384 - c[4] + c[5]);
+  long outer = eqRound((sum + alt)/2); //b0 + b2
+  c[1] = eqRound((sum - alt)/2);
+  c[0] = (type == EQ_NOTCH) ? outer/2 : eqRound(b0/a0*16384); //the notch keeps b0 = b2, its zeros on the unit circle
+  c[2] = outer - c[0];
+  if((c[5] >= 16384) || (c[5] <= -16384) || (c[4] >= 16384 + c[5]) || (-c[4] >= 16384 + c[5]))
+  {
+    return 0; //a pole on or past the unit circle once rounded
+  }
+  for(int i = 0; i < COEFFS_PER_BIQUAD; i++)
+  {
+    if((c[i] < -32768) || (c[i] > 32767))
+    {
+      return 0;
+    }
+  }
+  for(int i = 0; i < COEFFS_PER_BIQUAD; i++)
+  {
+    coeffs[i] = c[i];
+  }
+  return 1;
+}
+
+void eqPack(eqChannel &eq)
+{
+  eq.count = 0;
+  for(int b = 0; b < EQ_BANDS_MAX; b++)
+  {
+    if(eq.band[b].enabled && eq.band[b].designed)
+    {
+      memcpy(eq.coeffs + eq.count*COEFFS_PER_BIQUAD, eq.band[b].coeffs, COEFFS_PER_BIQUAD);
+      eq.bandOf[eq.count++] = b;
+    }
+  }
+}
+
+void eqSampleRate(eqChannel &eq, long fs)
+{
+  for(int b = 0; b < EQ_BANDS_MAX; b++)
+  {
+    eqBand &band = eq.band[b];
+    if(band.designed)
+    {
+      eqDesign(band.coeffs, band.type, band.hz, band.q, band.gain, fs);
+    }
+  }
+  eqPack(eq);
+}
+
+void eqBind(eqState &state, eqChannel &eq)
+{
+  long moved[EQ_BANDS_MAX*DELAY_COUNT];
+  for(int i = 0; i < eq.count; i++)
+  {
+    int from = -1;
+    for(int j = 0; j < state.count; j++)
+    {
+      if(state.bandOf[j] == eq.bandOf[i])
+      {
+        from = j;
+      }
+    }
+    for(int k = 0; k < DELAY_COUNT; k++)
+    {
+      moved[i*DELAY_COUNT + k] = (from < 0) ? 0 : state.delay[from*DELAY_COUNT + k];
+    }
+  }
+  for(int i = 0; i < eq.count; i++)
+  {
+    for(int k = 0; k < DELAY_COUNT; k++)
+    {
+      state.delay[i*DELAY_COUNT + k] = moved[i*DELAY_COUNT + k];
+    }
+    state.bandOf[i] = eq.bandOf[i];
+  }
+  state.count = eq.count;
+  state.coeffs = eq.coeffs;
+}
+
+void eqProcess(eqState &state, int* samples, int frameSize)
+{
+  filter_iirArbitraryOrder(frameSize, samples, state.coeffs, state.delay, 2*state.count);
+}
+
+void eqBandCommand(int channel)
+{
+  //syntax is: <int command><int channel><int band><int type><int hz><int q><int gain>, q in hundredths, gain in signed tenths of a dB
+  int band = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  int type = (shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6];
+  long hz = (unsigned int)((shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8]);
+  int q = (shieldMailbox.inbox[11]<<8) + shieldMailbox.inbox[10];
+  int gain = (short)((shieldMailbox.inbox[13]<<8) + shieldMailbox.inbox[12]); //a no-op on the C55x, sign extends where an int is wider
+  int coeffs[COEFFS_PER_BIQUAD];
+  if((band < 0) || (band >= EQ_BANDS_MAX) || !eqDesign(coeffs, type, hz, q, gain, audioRing.sampleRate))
+  {
+    int args[5] = {band, type, (int) hz, q, gain};
+    logWarn(LOG_EVENT_EQ_REFUSED, args, 5);
+    return;
+  }
+  stageParams &params = paramEdit(audioParams);
+  for(int ch = CHAN_LEFT; ch <= CHAN_RIGHT; ch++)
+  {
+    if((channel == ch) || (channel == CHAN_BOTH))
+    {
+      eqBand &b = params.eq[ch].band[band];
+      b.type = type;
+      b.hz = hz;
+      b.q = q;
+      b.gain = gain;
+      b.enabled = 1;
+      b.designed = 1;
+      memcpy(b.coeffs, coeffs, COEFFS_PER_BIQUAD);
+      eqPack(params.eq[ch]);
+    }
+  }
+}
+
+void eqEnableCommand(int channel)
+{
+  //syntax is: <int command><int channel><int band><int on>, a band keeps its settings while off
+  int band = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  int on = ((shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6]) != 0;
+  if((band < 0) || (band >= EQ_BANDS_MAX))
+  {
+    return;
+  }
+  stageParams &params = paramEdit(audioParams);
+  for(int ch = CHAN_LEFT; ch <= CHAN_RIGHT; ch++)
+  {
+    if((channel == ch) || (channel == CHAN_BOTH))
+    {
+      params.eq[ch].band[band].enabled = on;
+      eqPack(params.eq[ch]);
+    }
+  }
+}
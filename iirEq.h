@@ -0,0 +1,72 @@
+//Parametric EQ, run in the IIR stage after the channel's low and high pass.
+//Each channel has EQ_BANDS_MAX bands, peaking, low or high shelf, or notch,
+//set one at a time by mailbox with a frequency, a Q and a gain. A band's
+//biquad is designed on the device as the command arrives, from the RBJ audio
+//EQ cookbook through the prewarped bilinear transform, and rounded to the
+//filter_iirArbitraryOrder layout with a unity output scale. As in iirDesign,
+//the numerator is fitted to the rounded denominator, so the gains at DC and
+//Nyquist are exact whatever rounding does to the poles.
+//Only enabled bands are packed into the cascade filter_iirArbitraryOrder runs,
+//so three bands on out of eight cost three biquads and an EQ with none on
+//costs nothing. The packed cascade is banked with the bands; the delay lines
+//are running state, and follow their band when the packing moves it.
+//Boosts and cuts are kept to EQ_GAIN_MAX. A band that won't round is refused
+//and left as it was: a numerator past Q14, as high shelves over 6 dB and broad
+//boosts high up have, or poles too close to DC for Q14, a few tens of Hz.
+#ifndef _IIREQ_H_INCLUDED	//prevent eq library from being invoked twice and breaking the namespace
+#define _IIREQ_H_INCLUDED
+
+#include "core.h"
+#include "filter.h"
+#include "mailbox.h"
+#include "filterIir.h"
+
+#define EQ_BANDS_MAX 10
+#define EQ_GAIN_MAX 150 //tenths of a dB, boost or cut
+#define EQ_Q_MIN 10 //hundredths
+#define EQ_Q_MAX 10000
+
+#define EQ_PEAK 0
+#define EQ_LOW_SHELF 1
+#define EQ_HIGH_SHELF 2
+#define EQ_NOTCH 3 //the gain is ignored
+
+struct eqBand {
+  int type;
+  long hz;
+  int q; //hundredths, the shelves take it as the slope of their corner
+  int gain; //tenths of a dB
+  int enabled;
+  int designed; //coeffs hold a design, a band that never had one can't be enabled
+  int coeffs[COEFFS_PER_BIQUAD];
+};
+
+//banked, the bands as the commands set them and the cascade packed from them.
+struct eqChannel {
+  eqBand band[EQ_BANDS_MAX];
+  int coeffs[EQ_BANDS_MAX*COEFFS_PER_BIQUAD]; //enabled bands, in band order
+  int bandOf[EQ_BANDS_MAX]; //band each packed section came from
+  int count; //packed sections
+};
+
+//running, one per channel.
+struct eqState {
+  long delay[EQ_BANDS_MAX*DELAY_COUNT];
+  int bandOf[EQ_BANDS_MAX]; //band whose state each section of delay holds
+  int count;
+  int* coeffs; //packed cascade of the live bank
+};
+
+void eqChannelInit(eqChannel &eq); //every band off, flat
+int eqDesign(int* coeffs, int type, long hz, int q, int gain, long fs); //one band's biquad, 0 if it is out of range or won't round
+void eqPack(eqChannel &eq); //rebuild the cascade from the enabled bands
+void eqSampleRate(eqChannel &eq, long fs); //redesign every band for a new rate, a band that won't keeps its old coefficients
+void eqBind(eqState &state, eqChannel &eq); //pipeline side, moves each band's delay line to its new section, clearing new ones
+void eqProcess(eqState &state, int* samples, int frameSize); //runs the packed cascade in place
+
+void eqBandCommand(int channel); //<int command><int channel><int band><int type><int hz><int q><int gain>
+void eqEnableCommand(int channel); //<int command><int channel><int band><int on>
+
+extern eqState eqStateLeft, eqStateRight;
+
+#endif
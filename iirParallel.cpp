@@ -0,0 +1,31 @@
+#include "iirParallel.h"
+#include "filterIir.h"
+
+int iirBranchOut[I2S_DMA_BUF_LEN]; //a branch's output, only the worker runs the IIR stage
+long iirBranchSum[I2S_DMA_BUF_LEN];
+
+void iirParallelFilter(int* samples, const iirBranch* branches, int count, int frameSize)
+{
+  for(int i = 0; i < frameSize; i++)
+  {
+    iirBranchSum[i] = 0;
+  }
+  for(int b = 0; b < count; b++)
+  {
+    const int* out = samples; //no sections passes the input
+    if(branches[b].sections)
+    {
+      filter_iirArbitraryOrder(frameSize, samples, iirBranchOut, branches[b].coeffs, branches[b].delayBuf, 2*branches[b].sections);
+      out = iirBranchOut;
+    }
+    for(int i = 0; i < frameSize; i++)
+    {
+      iirBranchSum[i] += out[i];
+    }
+  }
+  for(int i = 0; i < frameSize; i++)
+  {
+    long sum = iirBranchSum[i];
+    samples[i] = (sum > 32767) ? 32767 : ((sum < -32768) ? -32768 : sum);
+  }
+}
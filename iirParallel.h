@@ -0,0 +1,25 @@
+//Parallel form IIR kernel.
+//Every branch is a cascade of biquads run from the block's input by
+//filter_iirArbitraryOrder, out of place into a scratch block, and the branch
+//outputs are summed, so a band stop is an lpf and an hpf side by side. A
+//branch of one biquad each gives the general sum of biquads form, for band
+//shapes a cascade of low and high passes cannot make.
+//Branches use the filter_iirArbitraryOrder layout: 7 words a section and 5
+//longs of state. A branch of no sections passes its input. The sum is kept
+//in 32 bits and saturates once at the end.
+#ifndef _IIRPARALLEL_H_INCLUDED	//prevent parallel iir library from being invoked twice and breaking the namespace
+#define _IIRPARALLEL_H_INCLUDED
+
+#include "core.h"
+
+#define IIR_BRANCH_MAX 20 //IIR_ORDER_MAX/2, one branch a biquad
+
+struct iirBranch {
+  int* coeffs; //sections*COEFFS_PER_BIQUAD words
+  long* delayBuf; //sections*DELAY_COUNT longs
+  int sections;
+};
+
+void iirParallelFilter(int* samples, const iirBranch* branches, int count, int frameSize); //filters a block in place, frameSize up to I2S_DMA_BUF_LEN
+
+#endif
@@ -0,0 +1,195 @@
+#include "iirSweep.h"
+#include "iirDesign.h"
+#include "paramBank.h"
+#include "blockRing.h"
+
+#define IIR_SWEEP_PI 3.14159265f
+
+iirSweepState iirSweepLeft, iirSweepRight;
+
+void iirSweepConfigInit(iirSweepConfig &config)
+{
+  config.pass = 0;
+  config.hz = 1000;
+  config.q = 71;
+  config.ms = 0;
+  config.g = 0;
+  config.steps = 0;
+  config.restart = 0;
+}
+
+float sweepG(long hz, long fs)
+{
+  float edge = (float) hz/fs;
+  if(edge > IIR_EDGE_MAX)
+  {
+    edge = IIR_EDGE_MAX;
+  }
+  return tan(IIR_SWEEP_PI*edge);
+}
+
+void iirSweepSampleRate(iirSweepConfig &config, long fs)
+{
+  if(config.pass)
+  {
+    config.g = sweepG(config.hz, fs);
+    config.steps = 0;
+    config.restart++;
+  }
+}
+
+//v as a Q15 mantissa and a shift, v = mantissa/2^shift.
+int sweepSplit(float v, int &shift)
+{
+  shift = 15;
+  while((v < 0.5f) && (shift < 40))
+  {
+    v *= 2;
+    shift++;
+  }
+  while(v >= 1)
+  {
+    v /= 2;
+    shift--;
+  }
+  long m = (long) floor(v*32768 + 0.5f);
+  return (m > 32767) ? 32767 : m;
+}
+
+//x*c/2^shift without a 48 bit product, c positive and under 2^15.
+inline long sweepMul(long x, int c, int shift)
+{
+  if(shift > 15)
+  {
+    return sweepMul(x, c, 15) >> (shift - 15);
+  }
+  return (x >> shift)*c + (((x & ((1L << shift) - 1))*c) >> shift);
+}
+
+//the fixed point coefficients of the filter's g and k.
+void sweepCoeffs(iirSweepState &state)
+{
+  float a1 = 1/(1 + state.g*(state.g + state.k));
+  long a1q = (long) floor(a1*32768 + 0.5f);
+  state.a1 = (a1q > 32767) ? 32767 : a1q;
+  state.a2 = sweepSplit(state.g*a1, state.a2Shift);
+  state.gm = sweepSplit(state.g, state.gShift);
+  state.k13 = (int) floor(state.k*(1L << IIR_SWEEP_K_SHIFT) + 0.5f);
+}
+
+void iirSweepBind(iirSweepState &state, iirSweepConfig &config)
+{
+  state.config = &config;
+  if(state.running && (state.restart == config.restart))
+  {
+    return;
+  }
+  float k = 100.0f/config.q;
+  if(!state.running || !config.steps)
+  {
+    if(!state.running)
+    {
+      state.ic1 = 0;
+      state.ic2 = 0;
+    }
+    state.g = config.g;
+    state.k = k;
+    state.steps = 0;
+  }
+  else
+  {
+    //one pow a sweep, the sub-blocks only multiply
+    state.steps = config.steps;
+    state.ratio = pow(config.g/state.g, 1.0f/config.steps);
+    state.kStep = (k - state.k)/config.steps;
+  }
+  state.restart = config.restart;
+  state.running = 1;
+  sweepCoeffs(state);
+}
+
+void iirSweepProcess(iirSweepState &state, int* samples, int frameSize)
+{
+  int pass = state.config->pass;
+  long ic1 = state.ic1;
+  long ic2 = state.ic2;
+  for(int start = 0; start < frameSize; start += IIR_SWEEP_SUB)
+  {
+    if(state.steps)
+    {
+      state.steps--;
+      if(state.steps)
+      {
+        state.g *= state.ratio;
+        state.k += state.kStep;
+      }
+      else //the last step lands on the target, whatever the rounding of the ratio
+      {
+        state.g = state.config->g;
+        state.k = 100.0f/state.config->q;
+      }
+      sweepCoeffs(state);
+    }
+    for(int i = start; i < start + IIR_SWEEP_SUB; i++)
+    {
+      long x = (long) samples[i] * (1L << IIR_SWEEP_FRAC); //a multiply, negative samples can't be shifted left
+      long v1 = sweepMul(ic1, state.a1, 15) + sweepMul(x - ic2, state.a2, state.a2Shift); //band
+      long v2 = ic2 + sweepMul(v1, state.gm, state.gShift); //low
+      ic1 = 2*v1 - ic1;
+      ic2 = 2*v2 - ic2;
+      long kv1 = sweepMul(v1, state.k13, IIR_SWEEP_K_SHIFT);
+      long y;
+      if(pass == LOW_PASS)
+      {
+        y = v2;
+      }
+      else if(pass == HIGH_PASS)
+      {
+        y = x - kv1 - v2;
+      }
+      else if(pass == BAND_PASS)
+      {
+        y = kv1;
+      }
+      else
+      {
+        y = x - kv1;
+      }
+      y >>= IIR_SWEEP_FRAC;
+      samples[i] = (y > 32767) ? 32767 : ((y < -32768) ? -32768 : y);
+    }
+  }
+  state.ic1 = ic1;
+  state.ic2 = ic2;
+}
+
+void iirSweepCommand(int channel)
+{
+  //syntax is: <int command><int channel><int pass><int hz><int q><int ms>, q in hundredths, pass 0 turns the filter off
+  int pass = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  long hz = (unsigned int)((shieldMailbox.inbox[7]<<8) + shieldMailbox.inbox[6]);
+  int q = (shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8];
+  unsigned int ms = (shieldMailbox.inbox[11]<<8) + shieldMailbox.inbox[10];
+  if((pass < 0) || (pass > BAND_STOP))
+  {
+    return;
+  }
+  hz = (hz < IIR_SWEEP_HZ_MIN) ? IIR_SWEEP_HZ_MIN : hz;
+  q = (q < IIR_SWEEP_Q_MIN) ? IIR_SWEEP_Q_MIN : ((q > IIR_SWEEP_Q_MAX) ? IIR_SWEEP_Q_MAX : q);
+  long fs = audioRing.sampleRate;
+  stageParams &params = paramEdit(audioParams);
+  for(int ch = CHAN_LEFT; ch <= CHAN_RIGHT; ch++)
+  {
+    if((channel == ch) || (channel == CHAN_BOTH))
+    {
+      iirSweepConfig &config = params.sweep[ch];
+      config.pass = pass;
+      config.hz = hz;
+      config.q = q;
+      config.ms = ms;
+      config.g = sweepG(hz, fs);
+      config.steps = (unsigned long) ms*(fs/100)/(10*IIR_SWEEP_SUB); //fs/100 keeps 65535 ms at 192 kHz inside a long
+      config.restart++;
+    }
+  }
+}
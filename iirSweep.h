@@ -0,0 +1,70 @@
+//Swept IIR filter, a state variable filter whose cutoff and Q glide to a target.
+//One command, "sweep to hz with this Q over ms", replaces a stream of
+//coefficient sets: the worker moves the filter every IIR_SWEEP_SUB samples, so
+//a sweep has no steps at the block rate to zipper, and the filter never swaps
+//its coefficients wholesale.
+//The filter is the trapezoidal (TPT) state variable form: its two integrator
+//states stay meaningful whatever the coefficients do, so it is stable while
+//they move, and the low, high, band and notch outputs all come from the same
+//state. g = tan(pi*hz/fs) moves geometrically, by a constant ratio each
+//sub-block, which is a log frequency glide, and 1/Q linearly. Each sub-block
+//takes one float multiply, add and divide; the samples run in fixed point,
+//the states with IIR_SWEEP_FRAC bits below the sample and the coefficients as
+//Q15 mantissas with a shift, so low cutoffs keep their precision.
+//The target is banked; where the filter is is running state, and a new sweep
+//starts from there. The first sweep, or one of 0 ms, jumps to its target.
+#ifndef _IIRSWEEP_H_INCLUDED	//prevent sweep library from being invoked twice and breaking the namespace
+#define _IIRSWEEP_H_INCLUDED
+
+#include "core.h"
+#include "mailbox.h"
+#include "filterIir.h"
+
+#define IIR_SWEEP_SUB 16 //samples between coefficient updates, the shortest block is a multiple
+#define IIR_SWEEP_FRAC 10 //state bits below the sample, the band output at Q 10 still fits a long
+#define IIR_SWEEP_HZ_MIN 10
+#define IIR_SWEEP_Q_MIN 50 //hundredths
+#define IIR_SWEEP_Q_MAX 1000
+#define IIR_SWEEP_K_SHIFT 13 //1/Q in Q13, up to 2
+
+//banked, what the last command asked for.
+struct iirSweepConfig {
+  int pass; //LOW_PASS, HIGH_PASS, BAND_PASS (unity peak) or BAND_STOP, 0 is off
+  long hz;
+  int q; //hundredths
+  unsigned int ms;
+  float g; //tan(pi*hz/fs) of the target
+  unsigned long steps; //sub-blocks the glide takes, 0 jumps
+  unsigned int restart; //bumped by every command, the worker starts the sweep when it changes
+};
+
+//running, one per channel.
+struct iirSweepState {
+  long ic1; //integrator states, IIR_SWEEP_FRAC bits below the sample
+  long ic2;
+  float g;
+  float k; //1/Q
+  float ratio; //g's step per sub-block
+  float kStep;
+  unsigned long steps; //sub-blocks left in the glide
+  unsigned int restart;
+  int running; //the pipeline compiled it in, the state is its own
+  int a1; //1/(1 + g*(g + k)), Q15
+  int a2; //g*a1, mantissa of a2Shift
+  int a2Shift;
+  int gm; //g, mantissa of gShift
+  int gShift;
+  int k13; //k in Q13
+  iirSweepConfig* config; //in the live bank
+};
+
+void iirSweepConfigInit(iirSweepConfig &config); //off
+void iirSweepSampleRate(iirSweepConfig &config, long fs); //the same target in Hz at a new rate, the filter jumps there
+void iirSweepBind(iirSweepState &state, iirSweepConfig &config); //pipeline side, starts a new sweep from where the filter is
+void iirSweepProcess(iirSweepState &state, int* samples, int frameSize); //in place
+
+void iirSweepCommand(int channel); //<int command><int channel><int pass><int hz><int q><int ms>
+
+extern iirSweepState iirSweepLeft, iirSweepRight;
+
+#endif
@@ -0,0 +1,112 @@
+#include "logRing.h"
+#include "cpuLoad.h"
+
+logRing logRings[LOG_CONTEXTS];
+
+void logInit()
+{
+  for(int c = 0; c < LOG_CONTEXTS; c++)
+  {
+    logRings[c].head = 0;
+    logRings[c].tail = 0;
+    logRings[c].dropped = 0;
+    logRings[c].reported = 0;
+  }
+#if LOG_SINK == LOG_SINK_SERIAL
+  Serial.begin(115200);
+#endif
+}
+
+void logWrite(int level, int event, const int* args, int count)
+{
+  int context = (audioLoad.nesting < LOG_CONTEXTS) ? audioLoad.nesting : LOG_CONTEXTS - 1;
+  logRing &ring = logRings[context];
+  unsigned short head = ring.head;
+  if((unsigned short)(head - ring.tail) >= LOG_RING_LEN)
+  {
+    ring.dropped++;
+    return;
+  }
+  logRecord &record = ring.records[head % LOG_RING_LEN];
+  record.level = level;
+  record.event = event;
+  record.stamp = micros();
+  for(int i = 0; i < LOG_ARGS; i++)
+  {
+    record.args[i] = (i < count) ? args[i] : 0;
+  }
+  ring.head = head + 1; //the record is complete before loop() can see it
+}
+
+int logRead(logRecord &record)
+{
+  int oldest = -1;
+  for(int c = 0; c < LOG_CONTEXTS; c++)
+  {
+    logRing &ring = logRings[c];
+    unsigned int dropped = ring.dropped;
+    if(dropped != ring.reported) //losses first, they happened before whatever is queued now could be written
+    {
+      record.level = LOG_LEVEL_WARN;
+      record.event = LOG_EVENT_DROPPED;
+      record.stamp = micros();
+      for(int i = 0; i < LOG_ARGS; i++)
+      {
+        record.args[i] = 0;
+      }
+      record.args[0] = dropped - ring.reported;
+      record.args[1] = c;
+      ring.reported = dropped;
+      return 1;
+    }
+    if((ring.tail != ring.head) &&
+       ((oldest < 0) || ((long)(ring.records[ring.tail % LOG_RING_LEN].stamp - logRings[oldest].records[logRings[oldest].tail % LOG_RING_LEN].stamp) < 0)))
+    {
+      oldest = c;
+    }
+  }
+  if(oldest < 0)
+  {
+    return 0;
+  }
+  logRing &ring = logRings[oldest];
+  record = ring.records[ring.tail % LOG_RING_LEN];
+  ring.tail = ring.tail + 1; //the writer may have the slot back
+  return 1;
+}
+
+void logDrain()
+{
+  logRecord record;
+  for(int n = 0; (n < LOG_DRAIN_MAX) && logRead(record); n++)
+  {
+#if LOG_SINK == LOG_SINK_MAILBOX
+    //<event><LOG_TAG><level><stamp low><stamp high><LOG_ARGS x args>
+    int message[LOG_MESSAGE_LEN];
+    message[0] = record.event;
+    message[1] = LOG_TAG;
+    message[2] = record.level;
+    message[3] = record.stamp & 0xFFFF;
+    message[4] = (record.stamp >> 16) & 0xFFFF;
+    for(int i = 0; i < LOG_ARGS; i++)
+    {
+      message[5 + i] = record.args[i];
+    }
+    shieldMailbox.transmit(message, LOG_MESSAGE_LEN);
+#else
+    //<stamp> <level> <event>: <args>
+    Serial.print(record.stamp);
+    Serial.print(" ");
+    Serial.print(record.level);
+    Serial.print(" ");
+    Serial.print(record.event);
+    Serial.print(":");
+    for(int i = 0; i < LOG_ARGS; i++)
+    {
+      Serial.print(" ");
+      Serial.print(record.args[i]);
+    }
+    Serial.println();
+#endif
+  }
+}
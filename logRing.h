@@ -0,0 +1,91 @@
+//Diagnostics log of fixed size binary records, drained by loop().
+//A record is a level, an event id, its micros() stamp and LOG_ARGS words.
+//Writers never wait and never print: each context that can log has its own
+//ring with a single writer, picked by the interrupt nesting cpuLoad tracks, so
+//loop() and the handlers, the audio interrupt and its worker, and a DMA
+//interrupt nested into the worker each write their own. The write index is
+//only stored by its writer and the read index by loop(), one word store each,
+//so nothing is locked. A full ring drops the record and counts it; the drain
+//reports the count as a LOG_EVENT_DROPPED record.
+//Levels above LOG_LEVEL compile to nothing. loop() sends up to LOG_DRAIN_MAX
+//records a pass, oldest first, to Serial as a text line or, with LOG_SINK set
+//to LOG_SINK_MAILBOX, as mailbox messages tagged LOG_TAG.
+#ifndef _LOGRING_H_INCLUDED	//prevent log library from being invoked twice and breaking the namespace
+#define _LOGRING_H_INCLUDED
+
+#include "core.h"
+#include "mailbox.h"
+
+#define LOG_LEVEL_OFF 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+#define LOG_LEVEL LOG_LEVEL_WARN //records above it are compiled away
+
+#define LOG_SINK_SERIAL 0
+#define LOG_SINK_MAILBOX 1
+#define LOG_SINK LOG_SINK_SERIAL
+
+#define LOG_ARGS 7 //a biquad's index and its six free coefficients
+#define LOG_RING_LEN 32 //records per context, a power of two
+#define LOG_CONTEXTS 3 //loop(), the audio interrupt, a DMA interrupt nested into its worker
+#define LOG_DRAIN_MAX 4 //records a loop() pass sends
+#define LOG_TAG (-896) //second word of a log message
+#define LOG_MESSAGE_LEN (5 + LOG_ARGS)
+
+//event ids, and what their arguments hold.
+#define LOG_EVENT_DROPPED 0 //records lost, context
+#define LOG_EVENT_IIR_DESIGN 1 //type, pass, hz, order, 1 if it came from the cache
+#define LOG_EVENT_IIR_FAILED 2 //type, pass, hz, order
+#define LOG_EVENT_IIR_SECTION 3 //pass, section, b0, b1, b2, a1, a2; the scale does not fit
+#define LOG_EVENT_RING_DROP 4 //blocks dropped at the input so far
+#define LOG_EVENT_EQ_REFUSED 5 //band, type, hz, q, gain
+#define LOG_EVENT_PIPE_FULL 6 //stage, channel of a step the graph had no room for
+#define LOG_EVENT_FIR_REFUSED 7 //type, taps, f1, f2, window, factor of a design that was not stored
+#define LOG_EVENT_IIR_REFUSED 8 //type, pass, hz, order; an order the type can't be designed at
+
+struct logRecord {
+  int level;
+  int event;
+  unsigned long stamp; //micros()
+  int args[LOG_ARGS];
+};
+
+struct logRing {
+  logRecord records[LOG_RING_LEN];
+  volatile unsigned short head; //next record to write, the writer's
+  volatile unsigned short tail; //next record to read, loop()'s
+  volatile unsigned int dropped; //the writer's
+  unsigned int reported; //loop()'s, dropped as last reported
+};
+
+void logInit(); //empties the rings, opens Serial for LOG_SINK_SERIAL
+void logWrite(int level, int event, const int* args, int count); //from any context, args past count are 0
+int logRead(logRecord &record); //loop() side, the oldest record of any ring. Returns 0 when they are all empty
+void logDrain(); //sends what logRead gives, up to LOG_DRAIN_MAX records. Call from loop()
+
+extern logRing logRings[LOG_CONTEXTS];
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define logError(event, args, count) logWrite(LOG_LEVEL_ERROR, (event), (args), (count))
+#else
+#define logError(event, args, count)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define logWarn(event, args, count) logWrite(LOG_LEVEL_WARN, (event), (args), (count))
+#else
+#define logWarn(event, args, count)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define logInfo(event, args, count) logWrite(LOG_LEVEL_INFO, (event), (args), (count))
+#else
+#define logInfo(event, args, count)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define logDebug(event, args, count) logWrite(LOG_LEVEL_DEBUG, (event), (args), (count))
+#else
+#define logDebug(event, args, count)
+#endif
+
+#endif
@@ -1,7 +1,7 @@
 #include "noise.h"
+#include "paramBank.h"
 
 
-noiseConfig noiseConfigLeft, noiseConfigRight;
 void noiseGen(noiseConfig &config, int buffer[], int frameSize)
 {
   if(config.enable == 1)
@@ -17,7 +17,7 @@ void noiseGen(noiseConfig &config, int buffer[], int frameSize)
     	rand16((DATA *)tempRand, frameSize);
     	gain(config.gain, tempRand, frameSize);
     	add((DATA *) tempRand, (DATA *) buffer, (DATA *) buffer, frameSize, 0);
-        delete tempRand;
+        delete[] tempRand;
     }
   }
 }
@@ -62,35 +62,37 @@ void noiseStart(int channel)
    memcpy(&gain, &recon, sizeof(gain));
    int sumMode = (shieldMailbox.inbox[9]<<8) + shieldMailbox.inbox[8];
    noiseConfig newConfig = noiseInit(gain, sumMode); //ddsInit builds a configuration
+   stageParams &params = paramEdit(audioParams);
 
    if(channel == CHAN_LEFT)
    {
-    noiseConfigLeft = newConfig;
+    params.noise[CHAN_LEFT] = newConfig;
    }
    else if(channel == CHAN_RIGHT)
    {
-    noiseConfigRight = newConfig;
+    params.noise[CHAN_RIGHT] = newConfig;
    }
    else if(channel == CHAN_BOTH)
    {
-    noiseConfigLeft = newConfig;
-    noiseConfigRight = newConfig;
+    params.noise[CHAN_LEFT] = newConfig;
+    params.noise[CHAN_RIGHT] = newConfig;
    }
 }
 
 void noiseStop(int channel)
 {
+   stageParams &params = paramEdit(audioParams);
    if(channel == CHAN_LEFT)
    {
-     noiseConfigLeft.enable = 0;
+     params.noise[CHAN_LEFT].enable = 0;
    }
    else if(channel == CHAN_RIGHT)
    {
-     noiseConfigRight.enable = 0;
+     params.noise[CHAN_RIGHT].enable = 0;
    }
    else if(channel == CHAN_BOTH)
    {
-     noiseConfigLeft.enable = 0;
-     noiseConfigRight.enable = 0;
+     params.noise[CHAN_LEFT].enable = 0;
+     params.noise[CHAN_RIGHT].enable = 0;
    }
 }
@@ -1,6 +1,5 @@
 //dds variables and buffers.
 //OH GOD so many globals. Such variable creep. Build a struct!
-//#define AUDIO_INTERRUPTION 1 //causes audio to be interrupted on SD card hit.
 #ifndef _NOISE_H_INCLUDED	//prevent mailbox library from being invoked twice and breaking the namespace
 #define _NOISE_H_INCLUDED
 
@@ -34,6 +33,4 @@ void noiseStart(int channel);
 void noiseStop(int channel);
 void gain(int gain, int buffer[], int frameSize);
 
-extern noiseConfig noiseConfigLeft, noiseConfigRight;
-
 #endif
@@ -0,0 +1,180 @@
+#include "paramBank.h"
+
+paramBanks audioParams;
+
+//points a bank's IIR channels at that bank's own coefficient arrays, a linked set at the left channel's.
+void bindBankCoeffs(stageParams &params)
+{
+  for(int ch = 0; ch < 2; ch++)
+  {
+    params.iir[ch].lpf.coeffs = params.iirCoeffs[params.iirLinked[0] ? CHAN_LEFT : ch][0];
+    params.iir[ch].hpf.coeffs = params.iirCoeffs[params.iirLinked[1] ? CHAN_LEFT : ch][1];
+  }
+}
+
+void bankInit(stageParams &params)
+{
+  for(int ch = 0; ch < 2; ch++)
+  {
+    ddsConfigInit(params.dds[ch]);
+    params.ddsRestart[ch] = 0;
+    noiseConfigInit(params.noise[ch]);
+    params.reverbDelay[ch] = 0;
+    params.firEnable[ch] = 0;
+    params.firVersion[ch] = 0;
+    params.firSetOf[ch] = ch;
+    iirSweepConfigInit(params.sweep[ch]);
+    eqChannelInit(params.eq[ch]);
+  }
+  for(int s = 0; s < FIR_SETS; s++)
+  {
+    memset(params.fir[s].coeffs, 0, FILTER_LENGTH_MAX);
+    params.fir[s].fft.parts = 0;
+    params.fir[s].length = FILTER_LENGTH_DEFAULT;
+    params.fir[s].symmetric = 0;
+    params.fir[s].factor = 1;
+    params.fir[s].refs = 1;
+  }
+  firNlmsConfigInit(params.nlms);
+  params.dds[CHAN_RIGHT].phaseToAmplitude = phase_to_amplitude_r;
+  mathChannelInit(0, 0, 0, 0, params.math); //the pipeline points it at every block
+  memset(params.iirCoeffs, 0, sizeof(params.iirCoeffs));
+  params.iirLinked[0] = 0;
+  params.iirLinked[1] = 0;
+  for(int i = 0; i < PIPE_STAGE_KINDS; i++)
+  {
+    params.order[i] = i; //the STAGE_ numbering is the original dmaIsr order
+  }
+
+  //both banks share the delay lines, a new coefficient set continues the old filter state.
+  params.iir[CHAN_LEFT] = newIIRChannel(IIRdelayBufferL_L, IIRdelayBufferL_H, params.iirCoeffs[0][0], params.iirCoeffs[0][1]);
+  params.iir[CHAN_RIGHT] = newIIRChannel(IIRdelayBufferR_L, IIRdelayBufferR_H, params.iirCoeffs[1][0], params.iirCoeffs[1][1]);
+  configureIIRChannel(params.iir[CHAN_LEFT], ALL_PASS, 0);
+  configureIIRChannel(params.iir[CHAN_RIGHT], ALL_PASS, 0);
+}
+
+void paramInit(paramBanks &banks)
+{
+  bankInit(banks.bank[0]);
+  bankInit(banks.bank[1]);
+  banks.live = 0;
+  banks.committed = 0;
+  banks.editing = 0;
+  banks.stale = 0;
+  banks.held = 0;
+}
+
+stageParams& paramEdit(paramBanks &banks)
+{
+  banks.editing = 1; //from here on the worker leaves the index alone
+  stageParams &shadow = banks.bank[!banks.live];
+  if(banks.stale)
+  {
+    //the running DDS fields may be mid-update in the copy, paramFlip hands them over.
+    shadow = banks.bank[banks.live];
+    bindBankCoeffs(shadow);
+    shadow.ddsRestart[CHAN_LEFT] = 0;
+    shadow.ddsRestart[CHAN_RIGHT] = 0;
+    banks.stale = 0;
+  }
+  return shadow;
+}
+
+void paramCommit(paramBanks &banks)
+{
+  if(banks.editing && !banks.held)
+  {
+    banks.committed = 1;
+    banks.editing = 0;
+  }
+}
+
+void paramHold(paramBanks &banks)
+{
+  banks.held = 1;
+}
+
+void paramRelease(paramBanks &banks, int keep)
+{
+  banks.held = 0;
+  if(keep)
+  {
+    paramCommit(banks);
+  }
+  else if(banks.editing)
+  {
+    //edits that were waiting for a flip go too, they share the bank with the partial upload.
+    banks.committed = 0;
+    banks.editing = 0;
+    banks.stale = 1; //the next paramEdit starts again from the live bank
+  }
+}
+
+void iirLink(stageParams &params, int channel, int set)
+{
+  int linked = (channel == CHAN_BOTH);
+  if(params.iirLinked[set] == linked)
+  {
+    return;
+  }
+  if(!linked) //the channel the load leaves alone goes on with the set they shared
+  {
+    memcpy(params.iirCoeffs[CHAN_RIGHT][set], params.iirCoeffs[CHAN_LEFT][set], COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2);
+  }
+  params.iirLinked[set] = linked;
+  bindBankCoeffs(params);
+}
+
+firSet& firSetAcquire(stageParams &params, int channel)
+{
+  int first = (channel == CHAN_RIGHT) ? CHAN_RIGHT : CHAN_LEFT;
+  int last = (channel == CHAN_LEFT) ? CHAN_LEFT : CHAN_RIGHT;
+  for(int ch = first; ch <= last; ch++)
+  {
+    params.fir[params.firSetOf[ch]].refs--;
+  }
+  int s = 0;
+  while(params.fir[s].refs) //the other channel holds at most one set, so one is free
+  {
+    s++;
+  }
+  for(int ch = first; ch <= last; ch++)
+  {
+    params.firSetOf[ch] = s;
+    params.fir[s].refs++;
+  }
+  return params.fir[s];
+}
+
+void firBind(stageParams &params, int channel)
+{
+  for(int ch = CHAN_LEFT; ch <= CHAN_RIGHT; ch++)
+  {
+    if((channel == ch) || (channel == CHAN_BOTH))
+    {
+      params.firEnable[ch] = 1;
+      params.firVersion[ch]++;
+    }
+  }
+}
+
+int paramFlip(paramBanks &banks)
+{
+  if(!banks.committed || banks.editing)
+  {
+    return 0;
+  }
+  stageParams &running = banks.bank[banks.live];
+  stageParams &next = banks.bank[!banks.live];
+  for(int ch = 0; ch < 2; ch++)
+  {
+    if(!next.ddsRestart[ch])
+    {
+      ddsHandover(next.dds[ch], running.dds[ch]);
+    }
+  }
+  banks.live = !banks.live;
+  banks.committed = 0;
+  banks.stale = 1;
+  return 1;
+}
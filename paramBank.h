@@ -0,0 +1,88 @@
+//Double-banked stage parameters.
+//Mailbox handlers run from loop() and the DMA interrupt preempts them, so they
+//never write the parameters the worker is reading. A handler opens the shadow
+//bank with paramEdit, readFilter commits it, and the pipeline makes it live at
+//the start of the next block by flipping a single index. Nothing is copied on
+//the audio side and the stream never stops for a reconfiguration.
+//Running state (delay lines, reverb memory, spectrum frames) is not banked.
+//A new FIR set is crossfaded in by the pipeline, which reads the outgoing set
+//from the bank that just went shadow for the one block it takes.
+//A streamed upload (coeffUpload.h) holds the shadow bank open across commands.
+#ifndef _PARAMBANK_H_INCLUDED	//prevent bank library from being invoked twice and breaking the namespace
+#define _PARAMBANK_H_INCLUDED
+
+#include "ddsCode.h"
+#include "noise.h"
+#include "channelMath.h"
+#include "filterIir.h"
+#include "firFft.h"
+#include "firMultirate.h"
+#include "firNlms.h"
+#include "iirEq.h"
+#include "iirSweep.h"
+#include "stageProfile.h"
+
+#define FILTER_LENGTH_DEFAULT (201) //same as filterFir.h, which only the sketch may include
+#define FILTER_LENGTH_MAX (511)
+#define FIR_DELAY_LEN (2*FILTER_LENGTH_MAX + 2) //filter_fir and firs take length + 2, the odd folded kernel length - 1 and a block, the canceller's reference history taps - 1 and a block; even, so the second line of a pair stays 32 bit aligned
+#define FIR_SETS 2 //a set per channel at most, linked channels share one
+#define PIPE_STAGE_KINDS (STAGE_SPECTRUM + 1) //stage kinds share their numbers with the STAGE_ profile ids
+
+//one FIR filter, which one or both channels run.
+struct firSet {
+  int coeffs[FILTER_LENGTH_MAX]; //direct form, filters up to FILTER_LENGTH_MAX taps
+  firSpectra fft; //partition spectra of the same filter, for the FFT engine
+  unsigned int length; //up to FIR_FFT_TAPS_MAX, longer than FILTER_LENGTH_MAX only runs in the FFT engine
+  int symmetric; //the taps mirror around the centre, firSymmetricFilter can fold them
+  int factor; //a multirate set runs coeffs at the rate divided by this, 1 runs at the full rate
+  int aa[FIR_MR_AA_MAX]; //anti-alias filter of a multirate set
+  int refs; //channels running it
+};
+
+struct stageParams {
+  ddsConfig dds[2];
+  int ddsRestart[2]; //a handler started a new tone, don't carry the running one over
+  noiseConfig noise[2];
+  mathChannelConfig math;
+  int reverbDelay[2];
+  iirChannel iir[2];
+  int iirCoeffs[2][2][COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2]; //channel, low/high pass
+  int iirLinked[2]; //low/high pass: loaded for CHAN_BOTH, the right channel runs the left one's set
+  iirSweepConfig sweep[2]; //swept filter after the IIR filters
+  eqChannel eq[2]; //parametric EQ after the swept filter
+  firSet fir[FIR_SETS];
+  int firSetOf[2]; //set each channel runs, each channel has its own length
+  int firEnable[2];
+  unsigned int firVersion[2]; //bumped by every new coefficient set, the pipeline crossfades when it changes
+  firNlmsConfig nlms; //on, it takes the FIR stage over from the sets
+  int order[PIPE_STAGE_KINDS]; //stage kinds in processing order
+};
+
+struct paramBanks {
+  stageParams bank[2];
+  volatile int live; //bank the worker runs on
+  volatile int committed; //the shadow bank is complete, flip at the next block
+  volatile int editing; //a handler is writing the shadow bank, don't flip
+  volatile int stale; //the shadow bank predates the last flip
+  volatile int held; //a streamed upload is writing the shadow bank over several commands, commits wait for its end
+};
+
+void paramInit(paramBanks &banks); //power-on defaults in both banks
+stageParams& paramEdit(paramBanks &banks); //open the shadow bank, brought up to date with the live one
+void paramCommit(paramBanks &banks); //hand an edited shadow bank to the worker, no-op if nothing was opened or it is held
+void paramHold(paramBanks &banks); //keep an opened shadow bank from the worker across commands
+void paramRelease(paramBanks &banks, int keep); //end a hold, committing the shadow bank or throwing its edits away
+int paramFlip(paramBanks &banks); //worker side, at a block boundary. Returns 1 if a new bank went live
+firSet& firSetAcquire(stageParams &params, int channel); //a set to write a new filter into, run by channel alone, or by both for CHAN_BOTH
+void iirLink(stageParams &params, int channel, int set); //before a load writes set 0 (low pass) or 1 (high pass) for channel: CHAN_BOTH links it, one channel unlinks it with the right channel keeping a copy
+void bindBankCoeffs(stageParams &params); //point the bank's IIR channels at its own coefficient arrays, or a linked set at the left one's
+void firBind(stageParams &params, int channel); //enable the channel(s) on the set they were just given, the pipeline crossfades into it
+
+inline stageParams& paramLive(paramBanks &banks)
+{
+  return banks.bank[banks.live];
+}
+
+extern paramBanks audioParams;
+
+#endif
@@ -0,0 +1,589 @@
+#include "pipeline.h"
+#include "logRing.h"
+
+pipelineGraph audioPipeline;
+int firScratch[I2S_DMA_BUF_LEN]; //a crossfade's outgoing block, or the input a warm-up replays
+
+void stepDds(pipelineStep &step, int frameSize)
+{
+  ddsGen(*(ddsConfig*) step.config, *step.buffer, frameSize);
+}
+
+void stepNoise(pipelineStep &step, int frameSize)
+{
+  noiseGen(*(noiseConfig*) step.config, *step.buffer, frameSize);
+}
+
+void stepMath(pipelineStep &step, int frameSize)
+{
+  mathChannelConfig &math = *(mathChannelConfig*) step.config;
+  math.inL = math.outL = step.buffer[0];
+  math.inR = math.outR = step.buffer[1];
+  processMathChannels(math, frameSize);
+}
+
+void stepReverb(pipelineStep &step, int frameSize)
+{
+  reverbClass &reverb = *(reverbClass*) step.config;
+  reverb.setInputBuffer(*step.buffer);
+  reverb.setOutputBuffer(*step.buffer);
+  reverb.processReverb(frameSize);
+}
+
+void stepIir(pipelineStep &step, int frameSize)
+{
+  iirChannel &iir = *(iirChannel*) step.config;
+  bindIIRChannel(iir, *step.buffer);
+  IIRProcessChannel(iir, frameSize);
+}
+
+void stepSweep(pipelineStep &step, int frameSize)
+{
+  iirSweepProcess(*(iirSweepState*) step.config, *step.buffer, frameSize);
+}
+
+void stepEq(pipelineStep &step, int frameSize)
+{
+  eqProcess(*(eqState*) step.config, *step.buffer, frameSize);
+}
+
+//keeps the last FIR_HISTORY_LEN samples of FIR input.
+void firRecord(firBinding &fir, const int* samples, int frameSize)
+{
+  if(frameSize > FIR_HISTORY_LEN)
+  {
+    samples += frameSize - FIR_HISTORY_LEN;
+    frameSize = FIR_HISTORY_LEN;
+  }
+  int first = FIR_HISTORY_LEN - fir.historyNext;
+  if(first > frameSize)
+  {
+    first = frameSize;
+  }
+  memcpy(fir.history + fir.historyNext, samples, first);
+  memcpy(fir.history, samples + first, frameSize - first);
+  fir.historyNext = (fir.historyNext + frameSize) % FIR_HISTORY_LEN;
+}
+
+void stepFir(pipelineStep &step, int frameSize)
+{
+  firBinding &fir = *(firBinding*) step.config;
+  firRecord(fir, *step.buffer, frameSize);
+  filter_fir(*step.buffer, fir.coeffs, *step.buffer, fir.delay, frameSize, fir.length);
+}
+
+void stepFirSymmetric(pipelineStep &step, int frameSize)
+{
+  firBinding &fir = *(firBinding*) step.config;
+  firRecord(fir, *step.buffer, frameSize);
+  firSymmetricFilter(*step.buffer, fir.coeffs, fir.delay, frameSize, fir.length);
+}
+
+void stepFirFft(pipelineStep &step, int frameSize)
+{
+  firBinding &fir = *(firBinding*) step.config;
+  firRecord(fir, *step.buffer, frameSize);
+  firFftProcess(*fir.state, *fir.spectra, *step.buffer, frameSize);
+}
+
+//decimates the block, runs the filter on the low rate samples and interpolates back, in place.
+void firMultirateRun(firMultirateState &state, const int* aa, int core, int* coeffs, int* delay, unsigned int length, int* samples, int frameSize)
+{
+  int* low = firDecimate(state, aa, samples, frameSize);
+  int count = frameSize / state.factor;
+  if(core == FIR_KERNEL_SYMMETRIC)
+  {
+    firSymmetricFilter(low, coeffs, delay, count, length);
+  }
+  else
+  {
+    filter_fir(low, coeffs, low, delay, count, length);
+  }
+  firInterpolate(state, aa, samples, frameSize);
+}
+
+void stepFirMultirate(pipelineStep &step, int frameSize)
+{
+  firBinding &fir = *(firBinding*) step.config;
+  firRecord(fir, *step.buffer, frameSize);
+  firMultirateRun(*fir.multirate, fir.aa, fir.core, fir.coeffs, fir.delay, fir.length, *step.buffer, frameSize);
+}
+
+//the adaptive canceller, the left block is the primary and the right one the reference.
+void stepNlms(pipelineStep &step, int frameSize)
+{
+  firNlmsState &nlms = *(firNlmsState*) step.config;
+  firNlmsProcess(nlms, *nlms.config, step.buffer[0], step.buffer[1], frameSize);
+}
+
+//the block a new set goes live in: the outgoing filter takes a copy of the
+//input on its own delay line, then the output ramps over to the incoming one.
+void stepFirFade(pipelineStep &step, int frameSize)
+{
+  firBinding &fir = *(firBinding*) step.config;
+  memcpy(firScratch, *step.buffer, frameSize);
+  if(fir.fadeKernel == FIR_KERNEL_FFT)
+  {
+    firFftProcess(*fir.state, *fir.fadeSpectra, firScratch, frameSize);
+  }
+  else if(fir.fadeKernel == FIR_KERNEL_MULTIRATE)
+  {
+    firMultirateRun(*fir.fadeMultirate, fir.fadeAa, fir.fadeCore, fir.fadeCoeffs, fir.fadeDelay, fir.fadeLength, firScratch, frameSize);
+  }
+  else if(fir.fadeKernel == FIR_KERNEL_SYMMETRIC)
+  {
+    firSymmetricFilter(firScratch, fir.fadeCoeffs, fir.fadeDelay, frameSize, fir.fadeLength);
+  }
+  else
+  {
+    filter_fir(firScratch, fir.fadeCoeffs, firScratch, fir.fadeDelay, frameSize, fir.fadeLength);
+  }
+  fir.steady(step, frameSize);
+  firCrossfade(*step.buffer, firScratch, frameSize);
+  step.run = fir.steady;
+}
+
+//brings the idle delay line of a channel up to date for an incoming time domain
+//filter. The same kernel and length can take the live delay line as it is,
+//otherwise the filter replays the input history from silence.
+void firWarmUp(firBinding &fir, const int* liveDelay, int sameLayout)
+{
+  if(sameLayout)
+  {
+    memcpy(fir.delay, liveDelay, FIR_DELAY_LEN);
+    return;
+  }
+  memset(fir.delay, 0, FIR_DELAY_LEN);
+  int count = fir.length - 1; //the newest sample is the first of the next block
+  if(count == 0)
+  {
+    return;
+  }
+  int start = (fir.historyNext + FIR_HISTORY_LEN - count) % FIR_HISTORY_LEN;
+  int first = FIR_HISTORY_LEN - start;
+  if(first > count)
+  {
+    first = count;
+  }
+  memcpy(firScratch, fir.history + start, first);
+  memcpy(firScratch + first, fir.history, count - first);
+  if(fir.kernel == FIR_KERNEL_SYMMETRIC)
+  {
+    firSymmetricFilter(firScratch, fir.coeffs, fir.delay, count, fir.length);
+  }
+  else
+  {
+    filter_fir(firScratch, fir.coeffs, firScratch, fir.delay, count, fir.length);
+  }
+}
+
+//the same for an incoming multirate filter, on the channel's idle multirate state.
+//At the same factor it carries on from the outgoing filter's decimator and
+//interpolator, and with the same core and length from its delay line too.
+//Otherwise it starts from silence: the low rate input a replay would need
+//spans factor times the input history.
+void firMultirateWarmUp(firBinding &fir, int factor)
+{
+  int sameFactor = (fir.fadeKernel == FIR_KERNEL_MULTIRATE) && (fir.fadeMultirate->factor == factor);
+  if(sameFactor)
+  {
+    memcpy(fir.multirate, fir.fadeMultirate, sizeof(firMultirateState));
+  }
+  else
+  {
+    firMultirateReset(*fir.multirate, factor);
+  }
+  if(sameFactor && (fir.core == fir.fadeCore) && (fir.length == fir.fadeLength))
+  {
+    memcpy(fir.delay, fir.fadeDelay, FIR_DELAY_LEN);
+  }
+  else
+  {
+    memset(fir.delay, 0, FIR_DELAY_LEN);
+  }
+}
+
+//the chain runs in place, so the spectrum copies its source out of the block
+//at the point of the chain the source names, before later stages overwrite it.
+void stepCapture(pipelineStep &step, int frameSize)
+{
+  updateSpectrumPointer(*(fftConfig*) step.config, *step.buffer, *step.buffer, *step.buffer, frameSize);
+}
+
+void stepSpectrum(pipelineStep &step, int frameSize)
+{
+  spectrum(*(fftConfig*) step.config, frameSize);
+}
+
+int iirActive(iirChannel &channel)
+{
+  if(channel.mode == LOW_PASS)
+  {
+    return channel.lpf.enabled && channel.lpf.order;
+  }
+  else if(channel.mode == HIGH_PASS)
+  {
+    return channel.hpf.enabled && channel.hpf.order;
+  }
+  else if((channel.mode == BAND_PASS) || (channel.mode == BAND_STOP))
+  {
+    return channel.lpf.enabled || channel.hpf.enabled;
+  }
+  else if(channel.mode == PARALLEL_SUM)
+  {
+    return channel.lpf.enabled && channel.lpf.order;
+  }
+  return 0;
+}
+
+void pipelineInit(pipelineGraph &graph, const pipelineSources &sources)
+{
+  graph.sources = sources;
+  graph.stepCount = 0;
+  graph.block[0] = 0;
+  graph.block[1] = 0;
+  for(int ch = 0; ch < 2; ch++)
+  {
+    firBinding &fir = graph.fir[ch];
+    fir.kernel = FIR_KERNEL_NONE;
+    fir.version = 0;
+    fir.pair = 0;
+    fir.delay = sources.firDelay[ch][0];
+    fir.multirate = sources.firMultirate[ch][0];
+    fir.aa = 0;
+    fir.core = FIR_KERNEL_DIRECT;
+    fir.coeffs = 0;
+    fir.spectra = 0;
+    fir.length = 0;
+    memset(fir.history, 0, FIR_HISTORY_LEN);
+    fir.historyNext = 0;
+  }
+  sources.nlms->running = 0;
+  sources.sweep[0]->running = 0;
+  sources.sweep[1]->running = 0;
+  graph.dirty = 1;
+}
+
+void pipelineSetOrder(stageParams &params, const int* order, int count)
+{
+  int newOrder[PIPE_STAGE_KINDS];
+  int used[PIPE_STAGE_KINDS] = {0};
+  int n = 0;
+  for(int i = 0; i < count; i++) //requested kinds, skipping unknown and repeated ones
+  {
+    int kind = order[i];
+    if((kind >= 0) && (kind < PIPE_STAGE_KINDS) && !used[kind])
+    {
+      used[kind] = 1;
+      newOrder[n++] = kind;
+    }
+  }
+  for(int kind = 0; kind < PIPE_STAGE_KINDS; kind++) //then whatever was left out
+  {
+    if(!used[kind])
+    {
+      newOrder[n++] = kind;
+    }
+  }
+  memcpy(params.order, newOrder, PIPE_STAGE_KINDS);
+}
+
+//appends a step working on one channel of the block. Returns 0 if the list is full.
+int addStep(pipelineGraph &graph, stepFunction run, void* config, int stage, int channel)
+{
+  if(graph.stepCount >= PIPE_STEPS_MAX)
+  {
+    int args[2] = {stage, channel};
+    logWarn(LOG_EVENT_PIPE_FULL, args, 2);
+    return 0;
+  }
+  pipelineStep &step = graph.steps[graph.stepCount++];
+  step.run = run;
+  step.config = config;
+  step.buffer = &graph.block[channel];
+  step.stage = stage;
+  step.charge = 1;
+  return 1;
+}
+
+//copies a channel into its spectrum buffer. The copy is charged to whichever
+//stage stamps the profile next.
+void addCapture(pipelineGraph &graph, int channel)
+{
+  if(addStep(graph, stepCapture, graph.sources.fft[channel], STAGE_SPECTRUM, channel))
+  {
+    graph.steps[graph.stepCount - 1].charge = 0;
+  }
+}
+
+void pipelineCompile(pipelineGraph &graph)
+{
+  pipelineSources &src = graph.sources;
+  int captured[2] = {0, 0};
+  graph.dirty = 0;
+  graph.stepCount = 0;
+  if(src.params == 0) //a command arrived before setup bound the stages
+  {
+    return;
+  }
+  stageParams &live = paramLive(*src.params);
+  int firKernelWas[2] = {graph.fir[0].kernel, graph.fir[1].kernel};
+  int nlmsWas = src.nlms->running;
+  src.nlms->running = 0;
+  graph.fir[0].kernel = FIR_KERNEL_NONE;
+  graph.fir[1].kernel = FIR_KERNEL_NONE;
+
+  for(int ch = 0; ch < 2; ch++) //the codec samples are only intact before the first stage
+  {
+    if(src.fft[ch]->enable && (src.fft[ch]->source == SOURCE_CODEC))
+    {
+      addCapture(graph, ch);
+      captured[ch] = 1;
+    }
+  }
+  for(int k = 0; k < PIPE_STAGE_KINDS; k++)
+  {
+    int kind = live.order[k];
+    int first = graph.stepCount;
+    for(int ch = 0; ch < 2; ch++)
+    {
+      //SOURCE_INPUT is what the first filter sees, SOURCE_OUTPUT the chain where the spectrum sits
+      int filterInput = ((kind == STAGE_IIR) || (kind == STAGE_FIR)) && (src.fft[ch]->source == SOURCE_INPUT);
+      if(src.fft[ch]->enable && !captured[ch] && (filterInput || (kind == STAGE_SPECTRUM)))
+      {
+        addCapture(graph, ch);
+        captured[ch] = 1;
+      }
+      if((kind == STAGE_DDS) && live.dds[ch].enable)
+      {
+        addStep(graph, stepDds, &live.dds[ch], kind, ch);
+      }
+      else if((kind == STAGE_NOISE) && live.noise[ch].enable)
+      {
+        addStep(graph, stepNoise, &live.noise[ch], kind, ch);
+      }
+      else if((kind == STAGE_REVERB) && (src.reverb[ch]->getReverbDelay() > 0))
+      {
+        addStep(graph, stepReverb, src.reverb[ch], kind, ch);
+      }
+      else if(kind == STAGE_IIR)
+      {
+        if(iirActive(live.iir[ch]))
+        {
+          addStep(graph, stepIir, &live.iir[ch], kind, ch);
+        }
+        if(live.sweep[ch].pass)
+        {
+          iirSweepBind(*src.sweep[ch], live.sweep[ch]); //a new command starts its sweep from where the filter is
+          addStep(graph, stepSweep, src.sweep[ch], kind, ch);
+        }
+        else
+        {
+          src.sweep[ch]->running = 0;
+        }
+        eqBind(*src.eq[ch], live.eq[ch]); //the bands' delay lines follow them to their packed sections
+        if(src.eq[ch]->count)
+        {
+          addStep(graph, stepEq, src.eq[ch], kind, ch);
+        }
+      }
+      else if((kind == STAGE_FIR) && live.nlms.taps)
+      {
+        if(ch == 0) //one step takes both channels, buffer[1] is the reference
+        {
+          firNlmsState &nlms = *src.nlms;
+          nlms.delay = src.firDelay[0][0];
+          nlms.history = src.firDelay[0][1];
+          //it starts over on a restart or a new length, and after the FIR sets had its delay lines
+          if(!nlmsWas || (nlms.taps != live.nlms.taps) || (nlms.restart != live.nlms.restart))
+          {
+            firNlmsReset(nlms, live.nlms.taps, live.nlms.restart);
+          }
+          nlms.config = &live.nlms;
+          nlms.running = 1;
+          addStep(graph, stepNlms, &nlms, kind, 0);
+        }
+      }
+      else if((kind == STAGE_FIR) && live.firEnable[ch])
+      {
+        firBinding &fir = graph.fir[ch];
+        //a new set while a filter runs is crossfaded, the outgoing one is still bound here.
+        int retune = (firKernelWas[ch] != FIR_KERNEL_NONE) && (fir.version != live.firVersion[ch]);
+        fir.fadeCoeffs = fir.coeffs;
+        fir.fadeDelay = fir.delay;
+        fir.fadeLength = fir.length;
+        fir.fadeSpectra = fir.spectra;
+        fir.fadeKernel = firKernelWas[ch];
+        fir.fadeMultirate = fir.multirate;
+        fir.fadeAa = fir.aa;
+        fir.fadeCore = fir.core;
+        firSet &set = live.fir[live.firSetOf[ch]];
+        fir.coeffs = set.coeffs;
+        fir.length = set.length;
+        fir.spectra = &set.fft;
+        fir.state = src.firFft[ch];
+        fir.aa = set.aa;
+        int folded = set.symmetric && firSymmetricFolds(set.length); //only where setup timed folding faster
+        fir.core = folded ? FIR_KERNEL_SYMMETRIC : FIR_KERNEL_DIRECT;
+        fir.version = live.firVersion[ch];
+        //multirate sets run decimated, long filters only exist as spectra, the rest go by the crossovers.
+        fir.kernel = FIR_KERNEL_DIRECT;
+        fir.steady = stepFir;
+        if(set.factor > 1)
+        {
+          fir.kernel = FIR_KERNEL_MULTIRATE;
+          fir.steady = stepFirMultirate;
+        }
+        else if((set.length > FILTER_LENGTH_MAX) || (set.length > firFftCrossover))
+        {
+          fir.kernel = FIR_KERNEL_FFT;
+          fir.steady = stepFirFft;
+        }
+        else if(folded)
+        {
+          fir.kernel = FIR_KERNEL_SYMMETRIC;
+          fir.steady = stepFirSymmetric;
+        }
+        if(retune && (fir.kernel == FIR_KERNEL_FFT) && (fir.fadeKernel == FIR_KERNEL_FFT))
+        {
+          //the input spectra don't depend on the filter, firFftPartition crossfades the output.
+          fir.state->fadeFrom = fir.fadeSpectra;
+          addStep(graph, stepFirFft, &fir, kind, ch);
+        }
+        else if(retune)
+        {
+          if(fir.kernel == FIR_KERNEL_FFT) //from the time domain, the spectra history starts from silence
+          {
+            firFftReset(*fir.state);
+          }
+          else
+          {
+            fir.pair = !fir.pair;
+            fir.delay = src.firDelay[ch][fir.pair];
+            fir.multirate = src.firMultirate[ch][fir.pair];
+            if(fir.kernel == FIR_KERNEL_MULTIRATE)
+            {
+              firMultirateWarmUp(fir, set.factor);
+            }
+            else
+            {
+              firWarmUp(fir, fir.fadeDelay, (fir.kernel == fir.fadeKernel) && (fir.length == fir.fadeLength));
+            }
+          }
+          addStep(graph, stepFirFade, &fir, kind, ch);
+        }
+        else
+        {
+          fir.delay = src.firDelay[ch][fir.pair];
+          fir.multirate = src.firMultirate[ch][fir.pair];
+          if(fir.kernel != firKernelWas[ch]) //the kernels keep their history differently, or it is stale
+          {
+            if(fir.kernel == FIR_KERNEL_FFT)
+            {
+              firFftReset(*fir.state);
+            }
+            else
+            {
+              memset(fir.delay, 0, FIR_DELAY_LEN);
+            }
+            if(fir.kernel == FIR_KERNEL_MULTIRATE)
+            {
+              firMultirateReset(*fir.multirate, set.factor);
+            }
+          }
+          addStep(graph, fir.steady, &fir, kind, ch);
+        }
+      }
+      else if((kind == STAGE_SPECTRUM) && src.fft[ch]->enable)
+      {
+        addStep(graph, stepSpectrum, src.fft[ch], kind, ch);
+      }
+    }
+    if((kind == STAGE_MATH) && ((live.math.modeL != MATH_NONE) || (live.math.modeR != MATH_NONE)))
+    {
+      addStep(graph, stepMath, &live.math, kind, 0); //buffer[0] and buffer[1] are both channels
+    }
+    for(int i = first; i < graph.stepCount - 1; i++) //charge the stage once, after its last step
+    {
+      graph.steps[i].charge = 0;
+    }
+  }
+}
+
+//makes a committed parameter bank live. Reverb lengths are applied here rather
+//than banked, a new length restarts the delay memory.
+//An FFT FIR crossfades when its partition completes, which a short block only
+//does every few blocks; the flip waits for that block so the outgoing spectra
+//are only read while the handlers can't touch them.
+void pipelineFlip(pipelineGraph &graph, int frameSize)
+{
+  pipelineSources &src = graph.sources;
+  if(src.params == 0)
+  {
+    return;
+  }
+  for(int ch = 0; ch < 2; ch++)
+  {
+    firBinding &fir = graph.fir[ch];
+    if((fir.kernel == FIR_KERNEL_FFT) && (fir.state->fill + frameSize < FIR_FFT_PART))
+    {
+      return;
+    }
+  }
+  if(!paramFlip(*src.params))
+  {
+    return;
+  }
+  stageParams &live = paramLive(*src.params);
+  for(int ch = 0; ch < 2; ch++)
+  {
+    if(src.reverb[ch]->getReverbDelay() != live.reverbDelay[ch])
+    {
+      src.reverb[ch]->setReverbDelay(live.reverbDelay[ch]);
+    }
+  }
+  graph.dirty = 1;
+}
+
+void pipelineRun(pipelineGraph &graph, int* left, int* right, int frameSize)
+{
+  pipelineFlip(graph, frameSize);
+  if(graph.dirty)
+  {
+    pipelineCompile(graph);
+  }
+  graph.block[0] = left;
+  graph.block[1] = right;
+  profileBlockStart();
+  for(int i = 0; i < graph.stepCount; i++)
+  {
+    pipelineStep &step = graph.steps[i];
+    step.run(step, frameSize);
+    if(step.charge)
+    {
+      profileStage(step.stage);
+    }
+  }
+  profileBlockEnd();
+}
+
+void pipelineInvalidate()
+{
+  audioPipeline.dirty = 1;
+}
+
+void pipelineOrderCommand()
+{
+  //syntax is: <int command><int channel><int count><count x int stage kind>
+  int order[PIPE_STAGE_KINDS];
+  int count = (shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4];
+  if(count > PIPE_STAGE_KINDS)
+  {
+    count = PIPE_STAGE_KINDS;
+  }
+  for(int i = 0; i < count; i++)
+  {
+    order[i] = (shieldMailbox.inbox[7+2*i]<<8) + shieldMailbox.inbox[6+2*i];
+  }
+  pipelineSetOrder(paramEdit(audioParams), order, count);
+}
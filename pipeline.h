@@ -0,0 +1,115 @@
+//Processing graph of the audio chain.
+//The enabled stages are compiled, in the configured order, into a flat list
+//of steps. The list is only rebuilt when a mailbox command marks it dirty, so
+//a disabled stage costs nothing per block. Every stage works in place on the
+//ring block handed to pipelineRun, which is itself a swapped-in DMA buffer.
+//Stage parameters and the stage order come from the live bank of paramBank.h. A committed bank is
+//flipped in at the start of a block and the list recompiled against it.
+//A new FIR set is crossfaded in over the block it goes live in: the outgoing
+//filter runs on its own delay line next to the incoming one, which was warmed
+//up from the latest input, so retunes don't click and a length change doesn't
+//misalign the delay line. Cutoff sweeps can be sent at the block rate.
+#ifndef _PIPELINE_H_INCLUDED	//prevent pipeline library from being invoked twice and breaking the namespace
+#define _PIPELINE_H_INCLUDED
+
+#include "Audio_exposed.h"
+#include "mailbox.h"
+#include "filter.h"
+#include "ddsCode.h"
+#include "noise.h"
+#include "channelMath.h"
+#include "reverb.h"
+#include "filterIir.h"
+#include "fftCode.h"
+#include "stageProfile.h"
+#include "paramBank.h"
+#include "firFft.h"
+#include "firSymmetric.h"
+#include "firMultirate.h"
+#include "firNlms.h"
+#include "iirEq.h"
+#include "iirSweep.h"
+
+#define PIPE_IIR_STEPS 3 //a channel's IIR stage runs its filters, the sweep and the EQ
+#define PIPE_STEPS_MAX (2*(PIPE_STAGE_KINDS - 1 + PIPE_IIR_STEPS) + 2) //a step per channel and kind, the IIR stage's three, plus two spectrum captures
+
+#define FIR_KERNEL_NONE 0 //the channel has no FIR step
+#define FIR_KERNEL_DIRECT 1 //filter_fir
+#define FIR_KERNEL_SYMMETRIC 2 //firSymmetricFilter, DSPLIB firs or the odd folded loop
+#define FIR_KERNEL_FFT 3 //partitioned overlap-save
+#define FIR_KERNEL_MULTIRATE 4 //decimate, direct or symmetric at the low rate, interpolate
+
+#define FIR_HISTORY_LEN FILTER_LENGTH_MAX //input kept to warm up an incoming time domain filter
+
+struct pipelineStep;
+typedef void (*stepFunction)(pipelineStep &step, int frameSize);
+
+//live coefficients and the delay line of one FIR channel, bound at compile time.
+struct firBinding {
+  int* coeffs;
+  int* delay;
+  unsigned int length;
+  firSpectra* spectra;
+  firFftState* state;
+  int kernel; //FIR_KERNEL_ the channel was compiled with
+  firMultirateState* multirate; //live one of the channel's pair, the pair flips with the delay lines
+  int* aa; //anti-alias filter of a multirate set
+  int core; //FIR_KERNEL_DIRECT or _SYMMETRIC, what a multirate set runs at the low rate
+  unsigned int version; //firVersion of the bound set, a different one is crossfaded in
+  int pair; //which of the channel's two delay lines is live
+  //the outgoing filter, for the block of a crossfade
+  int* fadeCoeffs;
+  int* fadeDelay;
+  unsigned int fadeLength;
+  firSpectra* fadeSpectra;
+  int fadeKernel;
+  firMultirateState* fadeMultirate;
+  int* fadeAa;
+  int fadeCore;
+  stepFunction steady; //what the step becomes once the crossfade is done
+  int history[FIR_HISTORY_LEN]; //latest input, a ring
+  unsigned int historyNext; //oldest sample, where the next one goes
+};
+
+//everything a graph can be compiled from, index 0 is left and 1 is right.
+//Only running state is bound here, the parameters are banked.
+struct pipelineSources {
+  paramBanks* params;
+  reverbClass* reverb[2];
+  int* firDelay[2][2]; //channel, pair. The FIR delay lines live in filterFir.h, which only the sketch may include
+  firFftState* firFft[2];
+  firMultirateState* firMultirate[2][2]; //channel, pair
+  firNlmsState* nlms; //runs on the left channel's FIR delay lines
+  iirSweepState* sweep[2];
+  eqState* eq[2];
+  fftConfig* fft[2];
+};
+
+struct pipelineStep {
+  stepFunction run;
+  void* config;
+  int** buffer; //&graph.block[channel], channel math gets both
+  int stage; //STAGE_ kind of the step
+  int charge; //1 on the last step of its stage, the profile is stamped after it
+};
+
+struct pipelineGraph {
+  pipelineSources sources;
+  pipelineStep steps[PIPE_STEPS_MAX];
+  int stepCount;
+  int* block[2]; //channels of the block being processed
+  firBinding fir[2];
+  volatile int dirty;
+};
+
+void pipelineInit(pipelineGraph &graph, const pipelineSources &sources); //marked dirty
+void pipelineSetOrder(stageParams &params, const int* order, int count); //into an opened shadow bank: listed kinds first, the rest keep their default order
+void pipelineCompile(pipelineGraph &graph); //rebuild the step list from the enabled stages
+void pipelineFlip(pipelineGraph &graph, int frameSize); //make a committed parameter bank live, marks the graph dirty if it did. Short blocks under an FFT FIR wait for the end of a partition
+void pipelineRun(pipelineGraph &graph, int* left, int* right, int frameSize); //process one block in place, flipping in a committed bank and compiling first if dirty
+void pipelineInvalidate(); //a command changed something the graph is compiled from that isn't banked, recompile at the next block
+void pipelineOrderCommand(); //recieve a new stage order. channel is ignored.
+
+extern pipelineGraph audioPipeline;
+
+#endif
@@ -33,6 +33,10 @@ void reverbClass::setReverbDelay(int delaySamps)
   reverbLength = delaySamps;  
   reverbPointer = 0;
 }
+int reverbClass::getReverbDelay()
+{
+  return reverbLength;
+}
 void reverbClass::setInputBuffer(int* in)
 {
   input = in;
@@ -41,21 +45,21 @@ void reverbClass::setOutputBuffer(int* out)
 {
   output = out;
 }
-void reverbClass::processReverb()
+void reverbClass::processReverb(int frameSize)
 {
   if(reverbLength > 0)
   {
-    for(int i = 0; i < I2S_DMA_BUF_LEN; i++) //copy new data in
+    for(int i = 0; i < frameSize; i++) //copy new data in
     {
       int index = (reverbPointer + reverbLength + i) % (reverbLength + I2S_DMA_BUF_LEN); //circular index to buffer
       reverbBuffer[index] = input[i];
     }
     
-    for(int i = 0; i < I2S_DMA_BUF_LEN; i++) //add arrays
+    for(int i = 0; i < frameSize; i++) //add arrays
     {
       int index = (reverbPointer + i) % (reverbLength + I2S_DMA_BUF_LEN); //circular index to buffer
       output[i] = input[i] + reverbBuffer[index];
     }
-    reverbPointer = (reverbPointer + I2S_DMA_BUF_LEN) % (reverbLength + I2S_DMA_BUF_LEN);
+    reverbPointer = (reverbPointer + frameSize) % (reverbLength + I2S_DMA_BUF_LEN);
   }
 }
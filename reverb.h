@@ -13,9 +13,10 @@ class reverbClass {
     reverbClass(int delaySamps, int* in, int* out);
     void init(int delaySamps, int* in, int* out);
     void setReverbDelay(int delaySamps);
+    int getReverbDelay();
     void setInputBuffer(int* in);
     void setOutputBuffer(int* out);
-    void processReverb();
+    void processReverb(int frameSize);
   
   private:
     unsigned long reverbPointer;
@@ -0,0 +1,215 @@
+//Portable reference versions of the DSPLIB and shield filter library calls
+//used by the shield application. Arithmetic follows the device conventions
+//(Q15 data, 40 bit style accumulation, saturation to 16 bits) so outputs are
+//close to the board's, but timings only show relative cost between stages.
+//Accumulators are int64_t to stand in for the 40 bit MAC accumulators.
+#include <complex>
+#include <vector>
+#include <stdint.h>
+#include "DSPLIB.h"
+#include "filter.h"
+
+static inline DATA sat16(int64_t v)
+{
+  if(v > 32767)
+    return 32767;
+  if(v < -32768)
+    return -32768;
+  return (DATA) v;
+}
+
+static unsigned int randSeed = 21845;
+
+void rand16init(void)
+{
+  randSeed = 21845;
+}
+
+ushort rand16(DATA *r, ushort nr)
+{
+  for(ushort i = 0; i < nr; i++)
+  {
+    randSeed = (randSeed * 31821 + 13849) & 0xFFFF;
+    r[i] = (DATA)(short) randSeed;
+  }
+  return 0;
+}
+
+ushort add(DATA *x, DATA *y, DATA *r, ushort nx, ushort scale)
+{
+  for(ushort i = 0; i < nx; i++)
+  {
+    int64_t v = (int64_t) x[i] + y[i];
+    r[i] = scale ? (DATA)(v >> 1) : sat16(v);
+  }
+  return 0;
+}
+
+ushort sub(DATA *x, DATA *y, DATA *r, ushort nx, ushort scale)
+{
+  for(ushort i = 0; i < nx; i++)
+  {
+    int64_t v = (int64_t) x[i] - y[i];
+    r[i] = scale ? (DATA)(v >> 1) : sat16(v);
+  }
+  return 0;
+}
+
+//r[j] = sum(x[j+k] * h[nh-1-k]), x holds nr+nh-1 samples. Safe in place (r == x).
+ushort convol(DATA *x, DATA *h, DATA *r, ushort nr, ushort nh)
+{
+  for(ushort j = 0; j < nr; j++)
+  {
+    int64_t acc = 0x4000;
+    for(ushort k = 0; k < nh; k++)
+    {
+      acc += (int64_t) x[j+k] * h[nh-1-k];
+    }
+    r[j] = sat16(acc >> 15);
+  }
+  return 0;
+}
+
+static void fftInPlace(std::vector< std::complex<double> > &a, bool inverse)
+{
+  size_t n = a.size();
+  for(size_t i = 1, j = 0; i < n; i++) //bit reversal
+  {
+    size_t bit = n >> 1;
+    for(; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if(i < j)
+      std::swap(a[i], a[j]);
+  }
+  for(size_t len = 2; len <= n; len <<= 1)
+  {
+    double ang = 2 * M_PI / len * (inverse ? 1 : -1);
+    std::complex<double> wlen(cos(ang), sin(ang));
+    for(size_t i = 0; i < n; i += len)
+    {
+      std::complex<double> w(1);
+      for(size_t k = 0; k < len/2; k++)
+      {
+        std::complex<double> u = a[i+k];
+        std::complex<double> v = a[i+k+len/2] * w;
+        a[i+k] = u + v;
+        a[i+k+len/2] = u - v;
+        w *= wlen;
+      }
+    }
+  }
+}
+
+//output packing follows DSPLIB: x[0] = Re(DC), x[1] = Re(Nyquist), then
+//Re/Im pairs for bins 1..nx/2-1. SCALE divides by nx.
+void rfft(DATA *x, ushort nx, ushort type)
+{
+  std::vector< std::complex<double> > a(nx);
+  for(ushort i = 0; i < nx; i++)
+    a[i] = x[i];
+  fftInPlace(a, false);
+  double s = (type == SCALE) ? 1.0 / nx : 1.0;
+  x[0] = sat16(lround(a[0].real() * s));
+  x[1] = sat16(lround(a[nx/2].real() * s));
+  for(ushort k = 1; k < nx/2; k++)
+  {
+    x[2*k] = sat16(lround(a[k].real() * s));
+    x[2*k+1] = sat16(lround(a[k].imag() * s));
+  }
+}
+
+//inverse of rfft. rfft(SCALE) followed by rifft(NOSCALE) returns the input.
+void rifft(DATA *x, ushort nx, ushort type)
+{
+  std::vector< std::complex<double> > a(nx);
+  a[0] = x[0];
+  a[nx/2] = x[1];
+  for(ushort k = 1; k < nx/2; k++)
+  {
+    a[k] = std::complex<double>(x[2*k], x[2*k+1]);
+    a[nx-k] = std::conj(a[k]);
+  }
+  fftInPlace(a, true);
+  double s = (type == SCALE) ? 1.0 / nx : 1.0;
+  for(ushort i = 0; i < nx; i++)
+    x[i] = sat16(lround(a[i].real() * s));
+}
+
+ushort firs(DATA *x, DATA *h, DATA *r, DATA *dbuffer, ushort nx, ushort nh)
+{
+  ushort taps = 2*nh;
+  DATA *delay = dbuffer + 1;
+  ushort index = dbuffer[0];
+  ushort oflag = 0;
+  if(index >= taps) //length changed under a running delay line
+    index = 0;
+  for(ushort i = 0; i < nx; i++)
+  {
+    delay[index] = x[i];
+    int64_t acc = 0x4000;
+    ushort newer = index; //x[n - k]
+    ushort older = (index + 1 == taps) ? 0 : index + 1; //x[n - taps + 1 + k]
+    for(ushort k = 0; k < nh; k++)
+    {
+      acc += (int64_t) h[k] * (delay[newer] + delay[older]);
+      newer = (newer == 0) ? taps - 1 : newer - 1;
+      older = (older + 1 == taps) ? 0 : older + 1;
+    }
+    acc >>= 15;
+    if((acc > 32767) || (acc < -32768))
+      oflag = 1;
+    r[i] = sat16(acc);
+    index = (index + 1 == taps) ? 0 : index + 1;
+  }
+  dbuffer[0] = index;
+  return oflag;
+}
+
+void filter_fir(DATA *x, DATA *h, DATA *r, DATA *dbuffer, ushort nx, ushort nh)
+{
+  DATA *delay = dbuffer + 1;
+  ushort index = dbuffer[0];
+  if(index >= nh) //length changed under a running delay line
+    index = 0;
+  for(ushort i = 0; i < nx; i++)
+  {
+    delay[index] = x[i];
+    int64_t acc = 0x4000;
+    ushort tap = index;
+    for(ushort k = 0; k < nh; k++)
+    {
+      acc += (int64_t) h[k] * delay[tap];
+      tap = (tap == 0) ? nh - 1 : tap - 1;
+    }
+    r[i] = sat16(acc >> 15);
+    index = (index + 1 == nh) ? 0 : index + 1;
+  }
+  dbuffer[0] = index;
+}
+
+void filter_iirArbitraryOrder(ushort nx, DATA *x, DATA *y, DATA *h, LDATA *dbuffer, ushort order)
+{
+  for(ushort i = 0; i < nx; i++)
+  {
+    int64_t s = x[i];
+    for(ushort b = 0; b < order/2; b++)
+    {
+      DATA *c = h + 7*b;
+      LDATA *d = dbuffer + 5*b;
+      int64_t acc = (int64_t) c[0]*s + (int64_t) c[1]*d[0] + (int64_t) c[2]*d[1] - (int64_t) c[4]*d[2] - (int64_t) c[5]*d[3];
+      DATA out = sat16(acc >> 14);
+      d[1] = d[0];
+      d[0] = s;
+      d[3] = d[2];
+      d[2] = out;
+      s = ((int64_t) out * c[6]) >> 15;
+    }
+    y[i] = sat16(s);
+  }
+}
+
+void filter_iirArbitraryOrder(ushort nx, DATA *x, DATA *h, LDATA *dbuffer, ushort order)
+{
+  filter_iirArbitraryOrder(nx, x, x, h, dbuffer, order);
+}
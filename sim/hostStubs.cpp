@@ -0,0 +1,85 @@
+//Host-side stand-ins for the board objects the shield application links
+//against: the codec driver, mailbox, SD card, OLED and Arduino timing calls.
+#include <chrono>
+#include <thread>
+#include "Audio_exposed.h"
+#include "mailbox.h"
+#include "SD.h"
+#include "OLED.h"
+
+SerialClass Serial;
+SDClass SD;
+OLEDClass disp;
+mailboxClass shieldMailbox;
+
+static Uint16 simInLeft[2][I2S_DMA_BUF_LEN];
+static Uint16 simInRight[2][I2S_DMA_BUF_LEN];
+static Uint16 simOutLeft[2][I2S_DMA_BUF_LEN];
+static Uint16 simOutRight[2][I2S_DMA_BUF_LEN];
+
+AudioClass AudioC;
+int AudioClass::isInitialized = 0;
+
+int AudioClass::Audio(void)
+{
+  return Audio(FALSE);
+}
+
+int AudioClass::Audio(int /*process*/, int adc_buffer_size, int dac_buffer_size)
+{
+  if((adc_buffer_size > I2S_DMA_BUF_LEN) || (dac_buffer_size > I2S_DMA_BUF_LEN) || (adc_buffer_size <= 0) || (dac_buffer_size <= 0))
+  {
+    return CSL_ESYS_FAIL;
+  }
+  adcBufferSize = adc_buffer_size;
+  dacBufferSize = dac_buffer_size;
+  if(!isInitialized) //like the real driver, a later call only retimes the transfers
+  {
+    for(int i = 0; i < 2; i++)
+    {
+      audioInLeft[i] = simInLeft[i];
+      audioInRight[i] = simInRight[i];
+      audioOutLeft[i] = simOutLeft[i];
+      audioOutRight[i] = simOutRight[i];
+    }
+    activeInBuf = 0;
+    activeOutBuf = 0;
+    isInitialized = 1;
+  }
+  return CSL_SOK;
+}
+
+AudioClass::~AudioClass(void)
+{
+}
+
+void AudioClass::attachIntr(void* /*function*/) {}
+void AudioClass::detachIntr(void) {}
+int AudioClass::setSamplingRate(long /*samplingRate*/) { return CSL_SOK; }
+int AudioClass::setOutputVolume(int /*volume*/) { return CSL_SOK; }
+int AudioClass::setInputGain(int /*lgain*/, int /*rgain*/) { return CSL_SOK; }
+
+void AudioClass::isrDma(void)
+{
+  //the simulator flips the ping-pong indices itself when it fakes a DMA event.
+}
+
+void pinMode(int /*pin*/, int /*mode*/) {}
+void digitalWrite(int /*pin*/, int /*value*/) {}
+
+static std::chrono::steady_clock::time_point simEpoch = std::chrono::steady_clock::now();
+
+unsigned long micros()
+{
+  return (unsigned long) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - simEpoch).count();
+}
+
+unsigned long millis()
+{
+  return micros() / 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
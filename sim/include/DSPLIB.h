@@ -0,0 +1,28 @@
+//Host build stand-in for the C55x DSPLIB header. The reference versions in
+//sim/dsplibRef.cpp are portable C, bit-compatible in spirit (Q15, saturating)
+//but not cycle-compatible with the hand-written assembly on the device.
+#ifndef _SIM_DSPLIB_H_INCLUDED
+#define _SIM_DSPLIB_H_INCLUDED
+
+#include "core.h"
+
+//DATA is a 16 bit word on the device, and the shield code casts int buffers
+//to DATA*, so it has to match int on the host.
+typedef int DATA;
+typedef long LDATA;
+
+#define SCALE 1
+#define NOSCALE 0
+
+void rand16init(void);
+ushort rand16(DATA *r, ushort nr);
+ushort add(DATA *x, DATA *y, DATA *r, ushort nx, ushort scale);
+ushort sub(DATA *x, DATA *y, DATA *r, ushort nx, ushort scale);
+ushort convol(DATA *x, DATA *h, DATA *r, ushort nr, ushort nh);
+//symmetric FIR of 2*nh taps, h holds the first nh. dbuffer is 2*nh + 2 words,
+//zeroed before first use, dbuffer[0] the index of the oldest sample.
+ushort firs(DATA *x, DATA *h, DATA *r, DATA *dbuffer, ushort nx, ushort nh);
+void rfft(DATA *x, ushort nx, ushort type);
+void rifft(DATA *x, ushort nx, ushort type);
+
+#endif
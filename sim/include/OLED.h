@@ -0,0 +1,21 @@
+//Host build stand-in for the shield OLED library.
+#ifndef _SIM_OLED_H_INCLUDED
+#define _SIM_OLED_H_INCLUDED
+
+#include "core.h"
+
+class OLEDClass {
+  public:
+    void oledInit() {}
+    void clear() {}
+    void clear(int /*line*/) {}
+    void flip() {}
+    void setline(int /*line*/) {}
+    template<typename T> void print(T) {}
+    void scrollDisplayLeft(int /*line*/) {}
+    void noAutoscroll() {}
+};
+
+extern OLEDClass disp;
+
+#endif
@@ -0,0 +1,29 @@
+//Host build stand-in for the SD library. The simulator has no card, so every
+//open fails and the modules fall back to whatever is already in RAM.
+#ifndef _SIM_SD_H_INCLUDED
+#define _SIM_SD_H_INCLUDED
+
+#include "core.h"
+
+#define FILE_READ 0
+#define FILE_WRITE 1
+
+class File {
+  public:
+    File() : open(false) {}
+    operator bool() { return open; }
+    int read(void* /*buffer*/, int /*length*/) { return 0; }
+    int seek(long /*position*/) { return 0; }
+    void close() { open = false; }
+    bool open;
+};
+
+class SDClass {
+  public:
+    int begin(int /*cs*/) { return 0; }
+    File open(const char* /*name*/, int /*mode*/) { return File(); }
+};
+
+extern SDClass SD;
+
+#endif
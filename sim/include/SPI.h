@@ -0,0 +1 @@
+//Host build stand-in for the shield SPI library; the mailbox stub needs nothing from it.
@@ -0,0 +1,98 @@
+//Host build stand-in for the Energia core.h of the C5535 DSP shield.
+//Only what the shield application touches is provided, so the DSP modules
+//can be compiled and timed on a Linux box by the offline simulator.
+#ifndef _SIM_CORE_H_INCLUDED
+#define _SIM_CORE_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/types.h>
+
+//a C55x long is 32 bits and the DDS phase accumulator relies on it wrapping
+//there. Everything included after this point sees long as a 32 bit int, so
+//system headers must be included before core.h.
+#define long int
+
+//on the C55x an int, a Uint16 and a char are all one 16 bit word. The shield
+//code freely casts between int and Uint16 buffers, so on the host Uint16 is
+//kept the same width as int.
+typedef unsigned int Uint16;
+typedef unsigned long Uint32;
+typedef int Int16;
+typedef long Int32;
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#define CSL_SOK 0
+#define CSL_ESYS_FAIL (-1)
+#define CSL_DMA_CHAN4 4
+#define CSL_DMA_CHAN5 5
+#define CSL_DMA_CHAN6 6
+#define CSL_DMA_CHAN7 7
+
+//compiler keywords of the TI C55x tools.
+#define interrupt
+#define asm(x) ((void)0)
+
+#ifdef __cplusplus
+//C55x memcpy/memmove/memset/malloc count 16 bit words and an int is one word there.
+//Keep that meaning for int buffers on the host; anything else (floats, longs)
+//is passed through as a byte count, which is what sizeof() gives on the host.
+inline size_t simWordBytes(int*, size_t n) { return n*sizeof(int); }
+inline size_t simWordBytes(unsigned int*, size_t n) { return n*sizeof(int); }
+inline size_t simWordBytes(const int*, size_t n) { return n*sizeof(int); }
+inline size_t simWordBytes(void*, size_t n) { return n; }
+#define memcpy(d, s, n) memcpy((d), (s), simWordBytes((d), (n)))
+#define memmove(d, s, n) memmove((d), (s), simWordBytes((d), (n)))
+#define memset(d, v, n) memset((d), (v), simWordBytes((d), (n)))
+#define malloc(n) malloc((n)*sizeof(int))
+
+//Arduino API subset.
+#define OUTPUT 1
+#define INPUT 0
+#define HIGH 1
+#define LOW 0
+#define LED0 0
+#define LED1 1
+#define LED2 2
+#define ARD_I2C_EN 3
+
+//buffer helpers of the shield core, lengths in words.
+inline void fillShortBuf(void *buffer, int value, int length)
+{
+  for(int i = 0; i < length; i++)
+    ((int*) buffer)[i] = value;
+}
+inline void copyShortBuf(const void *source, void *destination, int length)
+{
+  for(int i = 0; i < length; i++)
+    ((int*) destination)[i] = ((const int*) source)[i];
+}
+
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int value);
+void delayMicroseconds(unsigned int us);
+unsigned long micros();
+unsigned long millis();
+
+class SerialClass {
+  public:
+    void begin(long) {}
+    void end() {}
+    template<typename T> void print(T) {}
+    template<typename T> void println(T) {}
+    void println() {}
+};
+extern SerialClass Serial;
+#endif
+
+#endif
@@ -0,0 +1,16 @@
+//Host build stand-in for the shield filter library.
+#ifndef _SIM_FILTER_H_INCLUDED
+#define _SIM_FILTER_H_INCLUDED
+
+#include "DSPLIB.h"
+
+//dbuffer is nh+2 words long and must be zeroed before first use.
+void filter_fir(DATA *x, DATA *h, DATA *r, DATA *dbuffer, ushort nx, ushort nh);
+
+//h holds order/2 biquads of 7 words each: b0, b1, b2, a0, a1, a2, scale.
+//b and a are Q14 (a0 = 16384), scale is a Q15 gain applied to each section's
+//output. dbuffer holds 5 longs per biquad.
+void filter_iirArbitraryOrder(ushort nx, DATA *x, DATA *y, DATA *h, LDATA *dbuffer, ushort order);
+void filter_iirArbitraryOrder(ushort nx, DATA *x, DATA *h, LDATA *dbuffer, ushort order);
+
+#endif
@@ -0,0 +1,24 @@
+//Host build stand-in for the shield SPI mailbox library.
+#ifndef _SIM_MAILBOX_H_INCLUDED
+#define _SIM_MAILBOX_H_INCLUDED
+
+#include "core.h"
+
+#define SPI_MASTER 0
+#define MAILBOX_SIZE 2048
+
+class mailboxClass {
+  public:
+    void begin(int /*mode*/, void (*handler)()) { callback = handler; }
+    void receive() {}
+    void transmit(int* /*buffer*/, int length) { transmitCount++; transmitLength = length; }
+    unsigned char inbox[MAILBOX_SIZE];
+    int inboxSize;
+    void (*callback)();
+    long transmitCount;
+    int transmitLength;
+};
+
+extern mailboxClass shieldMailbox;
+
+#endif
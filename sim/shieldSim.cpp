@@ -0,0 +1,1104 @@
+/*
+	 Offline simulator of the shield audio path.
+	 Runs the processing graph of SHIELD_APP.ino, by default in the dmaIsr
+	 order (dds -> noise -> channel math -> reverb -> IIR -> FIR -> spectrum),
+	 over a WAV file or generated noise, and reports the cost of every stage.
+	 Stages that are not enabled are not compiled into the graph and cost 0.
+
+	 usage: shieldSim [options] [in.wav [out.wav]]
+	   -n <blocks>  512 sample blocks of input to generate when no input file is
+	                given (default 2000)
+	   -r <rate>    sampling rate for generated input (default 44100), one of
+	                the codec rates; a WAV input brings its own
+	   -f <taps>    FIR low pass on both channels, up to FIR_FFT_TAPS_MAX taps;
+	                past FILTER_LENGTH_MAX it can only run in the FFT engine
+	   -F <taps>    with -f, the right channel runs its own low pass of this
+	                length; without it both channels share one coefficient set
+	   -M <factor>  run the -f low pass in the multirate stage, decimated by 2, 4
+	                or 8; its taps and cutoff are at the low rate
+	   -P           benchmark the multirate stage: a 300 Hz low pass as 511
+	                direct taps against each factor with the taps cut to keep
+	                the transition width, with multiplies per sample, time,
+	                passband gain and the worst stopband gain from sines
+	   -N <taps>[,<mu>] adaptive noise canceller in the FIR slot: the right
+	                input is the noise reference and the left output the
+	                primary with the noise taken out; mu is the Q15 step size
+	   -c <taps>    FIR crossover: longer filters run in the FFT engine
+	                (default FIR_FFT_CROSSOVER)
+	   -X           benchmark the FIR engines over a range of lengths, both
+	                where they overlap, and print the crossover
+	   -D           benchmark the on-device FIR designer: time per design and
+	                worst tap error against a double precision design, for
+	                each length, window and response
+	   -J           benchmark the on-device IIR designer: time per design and
+	                worst response error against a double precision design, for
+	                each order, response and pass; Bessel poles are solved once
+	                per order, so its time is a retune's
+	   -i <order>   IIR low pass on both channels, up to IIR_ORDER_MAX
+	   -I <order>   IIR band stop on both channels (parallel lpf + hpf)
+	   -S <hz>[,<ms>] swept low pass on both channels, set to 200 Hz by command
+	                48, then from the second block gliding to <hz> over <ms>
+	                (default 1000) as one more command 48 would have it
+	   -L           print the log records (logRing.h) once the run is done, as
+	                loop() would have drained them
+	   -E <bands>[,<on>] parametric EQ on both channels: <bands> peaking bands
+	                of alternately +6 and -6 dB spread from 100 Hz to 10 kHz,
+	                set by command 46, of which the first <on> stay enabled
+	                (default all); the rest are turned off by command 47
+	   -s <points>  spectrum on both channels, up to WINDOW_LENGTH points
+	   -d           DDS tone summed into both channels
+	   -z           noise summed into both channels
+	   -v <samples> reverb delay on both channels
+	   -m <mode>    channel math mode (1 = sub, 2 = add)
+	   -o <list>    stage order as comma separated STAGE_ numbers, e.g. 5,4
+	                runs FIR before IIR; the stages left out keep their order
+	   -b <samples> block length, 64, 128, 256 or 512 (default 512)
+	   -B           benchmark: run the configuration at every block length and
+	                print one line each, showing the per-block overhead
+	   -w <hz>      offline, redesign the -f low pass with firDesign before every
+	                block, its cutoff sweeping by <hz> a block between 200 and
+	                8000 Hz, as a host sending retunes at the block rate would
+	   -U <words>   store the filters through the upload commands in chunks of
+	                <words>, one mailbox frame each, as a host streaming sets
+	                longer than a frame would; the output must not change
+	   -u <blocks>  offline, commit the FIR and IIR coefficients again every
+	                <blocks> blocks, as a host streaming updates would; the
+	                output must not change
+	   -q <depth>   block ring depth, 2 (double buffering) or 3 (default)
+	   -t <factor>  real-time model: drive the ring worker from a fake DMA
+	                clock, with every block costing <factor> times its host
+	                time, and count blocks dropped at the input and repeated
+	                at the output; the CPU load is taken on the fake clock
+
+	 Times are host times and only show the relative weight of the stages;
+	 cycles/sample are host TSC cycles where available.
+ */
+#include <chrono>
+#include <vector>
+#include <complex>
+#include <unistd.h>
+#include <stdint.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "wavFile.h"
+
+#include "Audio_exposed.h"
+#include "SD.h"
+#include "filter.h"
+#include "filterIir.h"
+#include "filterFir.h"
+#include "channelMath.h"
+#include "reverb.h"
+#include "ddsCode.h"
+#include "noise.h"
+#include "fftCode.h"
+#include "blockRing.h"
+#include "stageProfile.h"
+#include "cpuLoad.h"
+#include "pipeline.h"
+#include "paramBank.h"
+#include "firFft.h"
+#include "iirDesign.h"
+#include "logRing.h"
+
+reverbClass reverbL;
+reverbClass reverbR;
+
+//one line per kind of the processing graph, in STAGE_ order
+const char *stageNames[PIPE_STAGE_KINDS] = {"dds", "noise", "math", "reverb", "iir", "fir", "spectrum"};
+
+struct stageTiming {
+  double nsTotal;
+  double nsMax;
+  double cyclesTotal;
+};
+
+stageTiming timing[PIPE_STAGE_KINDS + 1]; //the last entry is the whole worker call
+
+static inline uint64_t hostCycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+struct stageProbe {
+  std::chrono::steady_clock::time_point start;
+  uint64_t cycles;
+};
+
+static inline void probeStart(stageProbe &probe)
+{
+  probe.cycles = hostCycles();
+  probe.start = std::chrono::steady_clock::now();
+}
+
+static inline void probeStop(stageProbe &probe, int stage, double *blockNs)
+{
+  blockNs[stage] += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - probe.start).count();
+  timing[stage].cyclesTotal += hostCycles() - probe.cycles;
+}
+
+//processAudioBlock, walking the compiled graph the way pipelineRun does with a
+//probe around each step; a stage's steps are summed before taking the max.
+void simProcessBlock(audioBlock &block)
+{
+  stageProbe probe, whole;
+  double blockNs[PIPE_STAGE_KINDS + 1] = {0};
+
+  probeStart(whole);
+
+  pipelineFlip(audioPipeline, block.length);
+  if(audioPipeline.dirty)
+  {
+    pipelineCompile(audioPipeline);
+  }
+  audioPipeline.block[0] = block.left;
+  audioPipeline.block[1] = block.right;
+  profileBlockStart();
+  for(int i = 0; i < audioPipeline.stepCount; i++)
+  {
+    pipelineStep &step = audioPipeline.steps[i];
+    probeStart(probe);
+    step.run(step, block.length);
+    probeStop(probe, step.stage, blockNs);
+    if(step.charge)
+    {
+      profileStage(step.stage);
+    }
+  }
+  profileBlockEnd();
+  probeStop(whole, PIPE_STAGE_KINDS, blockNs);
+  for(int s = 0; s <= PIPE_STAGE_KINDS; s++)
+  {
+    timing[s].nsTotal += blockNs[s];
+    if(blockNs[s] > timing[s].nsMax)
+      timing[s].nsMax = blockNs[s];
+  }
+
+  //loop() would send the spectrum; release it so the next frame is computed.
+  fftConfigLeft.bufferReady = 0;
+  fftConfigRight.bufferReady = 0;
+}
+
+//windowed sinc low pass in Q15, the filter of -f. Kept in double precision
+//rather than from firDesign, so the output of a run does not move with it.
+void simDesignFir(int *coeffs, int taps, double cutoff, double fs)
+{
+  double fc = cutoff / fs;
+  for(int i = 0; i < taps; i++)
+  {
+    double n = i - (taps - 1) / 2.0;
+    double sinc = (n == 0) ? 2 * fc : sin(2 * M_PI * fc * n) / (M_PI * n);
+    double window = 0.42 - 0.5 * cos(2 * M_PI * i / (taps - 1)) + 0.08 * cos(4 * M_PI * i / (taps - 1));
+    coeffs[i] = (int) lround(sinc * window * 32767);
+  }
+}
+
+//firDesign in double precision, for the error column of -D.
+void simDesignDouble(std::vector<double> &coeffs, int taps, int type, double f1, double f2, double fs, int window)
+{
+  int half = taps / 2;
+  if((type >= BAND_PASS) && (f1 > f2))
+  {
+    std::swap(f1, f2);
+  }
+  double beta = window / 10.0, i0Beta = std::cyl_bessel_i(0.0, beta);
+  std::vector<double> low(taps), high(taps);
+  double sumLow = 0, sumHigh = 0;
+  for(int i = 0; i < taps; i++)
+  {
+    int n = i - half;
+    double t = (double) n / half;
+    double w = (window == FIR_WINDOW_BLACKMAN) ? 0.42 + 0.5 * cos(M_PI * t) + 0.08 * cos(2 * M_PI * t)
+                                               : std::cyl_bessel_i(0.0, beta * sqrt(1 - t * t)) / i0Beta;
+    double fcLow = std::min(f1 / fs, 0.5), fcHigh = (type >= BAND_PASS) ? std::min(f2 / fs, 0.5) : 0;
+    low[i] = w * ((n == 0) ? 2 * fcLow : sin(2 * M_PI * fcLow * n) / (M_PI * n));
+    high[i] = w * ((n == 0) ? 2 * fcHigh : sin(2 * M_PI * fcHigh * n) / (M_PI * n));
+    sumLow += low[i];
+    sumHigh += high[i];
+  }
+  coeffs.resize(taps);
+  for(int i = 0; i < taps; i++)
+  {
+    double l = (sumLow > 0) ? low[i] / sumLow : 0, h = (sumHigh > 0) ? high[i] / sumHigh : 0;
+    double impulse = (i == half) ? 1 : 0;
+    double tap = (type == LOW_PASS) ? l : (type == HIGH_PASS) ? impulse - l : (type == BAND_PASS) ? h - l : impulse - h + l;
+    coeffs[i] = tap * 32767;
+  }
+}
+
+//gain in dB of the analog prototype iirDesign starts from, in double precision, at f
+//through the same prewarped bilinear transform. For the error column of -J.
+double simIirExactDb(int type, int pass, int order, double f, double hz, double fs)
+{
+  double edge = std::min(hz / fs, (double) IIR_EDGE_MAX);
+  double w = tan(M_PI * f / fs) / tan(M_PI * edge);
+  if(pass == HIGH_PASS)
+  {
+    w = 1 / w;
+  }
+  double ep = sqrt(pow(10.0, IIR_RIPPLE_DB / 10) - 1);
+  if(type == TYPE_BUTTER)
+  {
+    return -10 * log10(1 + pow(w, 2 * order));
+  }
+  if(type == TYPE_CHEBY)
+  {
+    double t = (w <= 1) ? cos(order * acos(w)) : cosh(order * acosh(w));
+    return -10 * log10(1 + ep * ep * t * t);
+  }
+  if(type == TYPE_BESSEL)
+  {
+    //|theta(0)/theta(j*w*w3)|, the reverse Bessel polynomial by its recurrence, w3 its -3 dB point
+    auto gain = [order](double x) {
+      std::complex<double> s(0, x), before(1), value = s + 1.0;
+      double value0 = 1; //theta(0), the s*s term drops out so it is the product of the odd factors
+      for(int n = 2; n <= order; n++)
+      {
+        std::complex<double> next = (double)(2 * n - 1) * value + s * s * before;
+        before = value;
+        value = next;
+        value0 *= 2 * n - 1;
+      }
+      return 20 * log10(value0 / std::abs(value));
+    };
+    double low = 0, high = 1;
+    while(gain(high) > -10 * log10(2.0))
+      high *= 2;
+    for(int i = 0; i < 60; i++)
+    {
+      double mid = (low + high) / 2;
+      (gain(mid) > -10 * log10(2.0) ? low : high) = mid;
+    }
+    return gain(w * (low + high) / 2);
+  }
+  //elliptic, from its poles and zeros after Orfanidis, with Landen moduli to 1e-15
+  double es = sqrt(pow(10.0, IIR_STOP_DB / 10) - 1), k1 = ep / es;
+  auto landen = [](double k) {
+    std::vector<double> v;
+    while((k > 1e-15) && (v.size() < 40))
+    {
+      k = pow(k / (1 + sqrt(1 - k * k)), 2);
+      v.push_back(k);
+    }
+    return v;
+  };
+  auto cde = [](std::complex<double> u, const std::vector<double> &v, bool sine) {
+    std::complex<double> x = sine ? sin(u * M_PI / 2.0) : cos(u * M_PI / 2.0);
+    for(int n = (int) v.size() - 1; n >= 0; n--)
+      x = (1 + v[n]) * x / (1.0 + v[n] * x * x);
+    return x;
+  };
+  std::vector<double> v = landen(sqrt(1 - k1 * k1));
+  double kp = pow(sqrt(1 - k1 * k1), order);
+  for(int i = 1; i <= order / 2; i++)
+    kp *= pow(cde((2.0 * i - 1) / order, v, true).real(), 4);
+  double k = sqrt(1 - kp * kp);
+  std::vector<double> v1 = landen(k1);
+  double y = 1 / ep;
+  for(size_t n = 0; n < v1.size(); n++)
+    y = y / (1 + sqrt(1 + y * y * pow(n ? v1[n - 1] : k1, 2))) * 2 / (1 + v1[n]);
+  double v0 = 2 / M_PI * asinh(y) / order;
+  v = landen(k);
+  std::complex<double> s(0, w), h = pow(10.0, -IIR_RIPPLE_DB / 20);
+  for(int i = 1; i <= order / 2; i++)
+  {
+    double u = (2.0 * i - 1) / order;
+    double zero = 1 / (k * cde(u, v, false).real());
+    std::complex<double> pole = std::complex<double>(0, 1) * cde(std::complex<double>(u, -v0), v, false);
+    h *= (s * s + zero * zero) / (zero * zero) * std::norm(pole) / ((s - pole) * (s - std::conj(pole)));
+  }
+  return 20 * log10(std::abs(h));
+}
+
+//gain in dB of an order long cascade in the filter_iirArbitraryOrder layout.
+double simBiquadDb(const int *coeffs, int order, double f, double fs)
+{
+  std::complex<double> z = std::polar(1.0, -2 * M_PI * f / fs), h = 1;
+  for(int b = 0; b < order/2; b++)
+  {
+    const int *c = coeffs + COEFFS_PER_BIQUAD*b;
+    h *= ((double) c[0] + (double) c[1] * z + (double) c[2] * z * z) / ((double) c[3] + (double) c[4] * z + (double) c[5] * z * z) * (c[6] / 32768.0);
+  }
+  return 20 * log10(std::abs(h) + 1e-30);
+}
+
+//pass-through biquads: the kernel does the same work whatever the response.
+void simUnityBiquads(int *coeffs, int order)
+{
+  for(int b = 0; b < order/2; b++)
+  {
+    int *c = coeffs + COEFFS_PER_BIQUAD*b;
+    c[0] = 16384;
+    c[1] = 0;
+    c[2] = 0;
+    c[3] = 16384;
+    c[4] = 0;
+    c[5] = 0;
+    c[6] = 32767;
+  }
+}
+
+//read interrupt: the codec has filled the active input buffers, dmaIsr swaps
+//them into a free ring block and isrDma flips the ping-pong index.
+void simDmaRead(const wavData &wav, int index)
+{
+  size_t base = (size_t) index * audioRing.readLength;
+  Uint16 *left = AudioC.audioInLeft[AudioC.activeInBuf];
+  Uint16 *right = AudioC.audioInRight[AudioC.activeInBuf];
+  for(int i = 0; i < audioRing.readLength; i++)
+  {
+    left[i] = wav.left[base + i];
+    right[i] = wav.right[base + i];
+  }
+  audioBlock *block = blockRingFillSlot(audioRing);
+  if(block)
+  {
+    swapBlockBuffer(block->left, AudioC.audioInLeft[AudioC.activeInBuf]);
+    swapBlockBuffer(block->right, AudioC.audioInRight[AudioC.activeInBuf]);
+    blockRingFilled(audioRing);
+  }
+  blockRingRetimeRead(audioRing);
+  AudioC.activeInBuf = !AudioC.activeInBuf;
+}
+
+//write interrupt: dmaIsr swaps the next processed block into the idle output
+//buffers, which isrDma then starts playing. On a repeat the codec plays
+//whatever the idle buffers held, as it does on the board.
+void simDmaWrite(wavData &out)
+{
+  int writeBufIndex = !AudioC.activeOutBuf;
+  audioBlock *block = blockRingDrainSlot(audioRing);
+  if(block)
+  {
+    swapBlockBuffer(block->left, AudioC.audioOutLeft[writeBufIndex]);
+    swapBlockBuffer(block->right, AudioC.audioOutRight[writeBufIndex]);
+    blockRingRetimeWrite(audioRing, *block);
+    blockRingDrained(audioRing);
+  }
+  AudioC.activeOutBuf = writeBufIndex;
+  for(int i = 0; i < audioRing.writeLength; i++)
+  {
+    out.left.push_back((short) AudioC.audioOutLeft[writeBufIndex][i]);
+    out.right.push_back((short) AudioC.audioOutRight[writeBufIndex][i]);
+  }
+}
+
+//fake DMA clock. Read and write interrupts arrive every block period, half a
+//period apart; the worker takes its measured host time times slowdown and is
+//preempted by the interrupts. Returns the number of blocks processed.
+int simRealTime(const wavData &wav, wavData &out, int blocks, double periodNs, double slowdown)
+{
+  double nextRead = periodNs, nextWrite = 1.5 * periodNs, workerDone = -1;
+  int reads = 0, processedBlocks = 0;
+  unsigned int loadPeak = 0;
+  loadInit(0);
+
+  while((reads < blocks) || (workerDone >= 0))
+  {
+    double now;
+    if((workerDone >= 0) && (workerDone <= nextRead) && (workerDone <= nextWrite))
+    {
+      now = workerDone;
+      blockRingProcessed(audioRing);
+      loadExit((unsigned long)(now / 1000));
+      workerDone = -1;
+    }
+    else if(nextRead <= nextWrite)
+    {
+      now = nextRead;
+      nextRead += periodNs;
+      if(reads < blocks)
+      {
+        loadBlock((unsigned long)(now / 1000));
+        if(audioLoad.windowReady)
+        {
+          audioLoad.windowReady = 0;
+          loadPeak = audioLoad.peak > loadPeak ? audioLoad.peak : loadPeak;
+        }
+        simDmaRead(wav, reads);
+        reads++;
+      }
+    }
+    else
+    {
+      now = nextWrite;
+      nextWrite += periodNs;
+      simDmaWrite(out);
+    }
+
+    audioBlock *pending = blockRingProcessSlot(audioRing);
+    if((workerDone < 0) && pending)
+    {
+      loadEnter((unsigned long)(now / 1000));
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      simProcessBlock(*pending);
+      workerDone = now + slowdown * std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+      processedBlocks++;
+    }
+  }
+  printf("real-time model: ring depth %d, %u blocks dropped at the input, %u output blocks repeated, %u blocks late, fewest blocks queued %u\n",
+         audioRing.depth, audioRing.dropped, audioRing.repeated, audioRing.late, audioRing.minQueued);
+  printf("cpu load: last window average %.1f%%, highest window peak %.1f%%, highest block %.1f%%\n",
+         audioLoad.average / 10.0, loadPeak / 10.0, audioLoad.max / 10.0);
+  return processedBlocks;
+}
+
+//filter settings of the run, written to the shadow bank as IIRRecieve and FIRRecieve would.
+struct simFilterConfig {
+  int firTaps;
+  int firTapsRight; //0: the right channel shares the left's set
+  int firFactor; //the left set runs in the multirate stage when more than 1
+  long firCutoff;
+  int iirOrder;
+  int iirMode;
+  long sampleRate;
+  int uploadChunk; //words per upload frame, 0 writes the bank directly
+};
+
+simFilterConfig simFilters;
+int simUpdateEvery = 0;
+long simSweepStep = 0;
+int simGlideHz = 0, simGlideMs = 1000;
+
+//a command as readFilter would get it, words little endian from the command on.
+void simFrame(const int* words, int count)
+{
+  for(int i = 0; i < count; i++)
+  {
+    shieldMailbox.inbox[2*i] = words[i] & 0xFF;
+    shieldMailbox.inbox[2*i+1] = (words[i] >> 8) & 0xFF;
+  }
+  shieldMailbox.inboxSize = 2*count;
+}
+
+//a set sent as commands 43 to 45, chunk words a frame.
+void simUpload(int target, int channel, const int* coeffs, int words, int orderLow, int orderHigh, int mode, int chunk)
+{
+  int begin[] = {43, channel, target, words, orderLow, orderHigh, mode};
+  simFrame(begin, 7);
+  uploadBeginCommand(channel);
+  paramCommit(audioParams); //as readFilter does, it waits for the end
+  std::vector<int> frame(chunk + 3);
+  for(int offset = 0; offset < words; offset += chunk)
+  {
+    int count = std::min(chunk, words - offset);
+    frame[0] = 44;
+    frame[1] = channel;
+    frame[2] = offset;
+    std::copy(coeffs + offset, coeffs + offset + count, &frame[3]);
+    simFrame(&frame[0], count + 3);
+    uploadChunkCommand();
+    paramCommit(audioParams);
+  }
+  int end[] = {45, channel, 1};
+  simFrame(end, 3);
+  uploadEndCommand();
+  paramCommit(audioParams);
+}
+
+void simStoreFilters(const simFilterConfig &config)
+{
+  stageParams &params = paramEdit(audioParams);
+  if(config.iirOrder && config.uploadChunk)
+  {
+    std::vector<int> coeffs(config.iirOrder*COEFFS_PER_BIQUAD);
+    simUnityBiquads(&coeffs[0], config.iirOrder);
+    simUnityBiquads(&coeffs[config.iirOrder/2*COEFFS_PER_BIQUAD], config.iirOrder);
+    simUpload(UPLOAD_IIR_DUAL, CHAN_BOTH, &coeffs[0], coeffs.size(), config.iirOrder, config.iirOrder, config.iirMode, config.uploadChunk);
+    paramEdit(audioParams);
+  }
+  else if(config.iirOrder)
+  {
+    iirLink(params, CHAN_BOTH, 0); //one set for both channels, as a CHAN_BOTH load leaves them
+    iirLink(params, CHAN_BOTH, 1);
+    for(int ch = 0; ch < 2; ch++)
+    {
+      simUnityBiquads(params.iir[ch].lpf.coeffs, config.iirOrder);
+      simUnityBiquads(params.iir[ch].hpf.coeffs, config.iirOrder);
+      params.iir[ch].lpf.order = params.iir[ch].hpf.order = config.iirOrder;
+      setIIRChannelMode(params.iir[ch], config.iirMode);
+    }
+  }
+  if(config.firTaps)
+  {
+    std::vector<int> coeffs(config.firTaps);
+    simDesignFir(&coeffs[0], config.firTaps, config.firCutoff, (double) config.sampleRate / config.firFactor);
+    if(config.uploadChunk && (config.firFactor == 1))
+    {
+      simUpload(UPLOAD_FIR, config.firTapsRight ? CHAN_LEFT : CHAN_BOTH, &coeffs[0], config.firTaps, 0, 0, 0, config.uploadChunk);
+      paramEdit(audioParams);
+    }
+    else if(config.firFactor > 1)
+    {
+      firStoreMultirate(params, config.firTapsRight ? CHAN_LEFT : CHAN_BOTH, &coeffs[0], config.firTaps, config.firFactor);
+    }
+    else
+    {
+      firStore(params, config.firTapsRight ? CHAN_LEFT : CHAN_BOTH, &coeffs[0], config.firTaps);
+    }
+  }
+  if(config.firTaps && config.firTapsRight)
+  {
+    std::vector<int> coeffs(config.firTapsRight);
+    simDesignFir(&coeffs[0], config.firTapsRight, config.firCutoff, config.sampleRate);
+    if(config.uploadChunk)
+    {
+      simUpload(UPLOAD_FIR, CHAN_RIGHT, &coeffs[0], config.firTapsRight, 0, 0, 0, config.uploadChunk);
+      paramEdit(audioParams);
+    }
+    else
+    {
+      firStore(params, CHAN_RIGHT, &coeffs[0], config.firTapsRight);
+    }
+  }
+}
+
+//command 48 on both channels, a low pass at Q 0.71.
+void simGlide(int hz, int ms)
+{
+  int frame[] = {48, CHAN_BOTH, LOW_PASS, hz, 71, ms};
+  simFrame(frame, 6);
+  iirSweepCommand(CHAN_BOTH);
+  paramCommit(audioParams);
+  pipelineInvalidate();
+}
+
+//-E bands, through the mailbox handlers as readFilter would run them.
+void simEq(int bands, int on, long sampleRate)
+{
+  for(int b = 0; (b < bands) && (b < EQ_BANDS_MAX); b++)
+  {
+    int hz = (int) lround(100 * pow(100.0, (bands > 1) ? (double) b / (bands - 1) : 0));
+    int frame[] = {46, CHAN_BOTH, b, EQ_PEAK, std::min(hz, (int)(sampleRate * IIR_EDGE_MAX)), 141, (b & 1) ? -60 : 60};
+    simFrame(frame, 7);
+    eqBandCommand(CHAN_BOTH);
+  }
+  for(int b = on; (b < bands) && (b < EQ_BANDS_MAX); b++)
+  {
+    int frame[] = {47, CHAN_BOTH, b, 0};
+    simFrame(frame, 4);
+    eqEnableCommand(CHAN_BOTH);
+  }
+}
+
+//next cutoff of a -w sweep, bouncing between the ends.
+void simSweep()
+{
+  static long cutoff = 1000;
+  static long step = simSweepStep;
+  cutoff += step;
+  if((cutoff > 8000) || (cutoff < 200))
+  {
+    step = -step;
+    cutoff += 2 * step;
+  }
+  firDesignStore(CHAN_BOTH, LOW_PASS, simFilters.firTaps, cutoff, 0, FIR_WINDOW_BLACKMAN);
+  paramCommit(audioParams);
+  pipelineInvalidate();
+}
+
+//push the input through the ring at one block length, offline or against the
+//fake DMA clock. Returns the number of blocks processed.
+int simRun(const wavData &wav, wavData &out, int ringDepth, int length, double slowdown)
+{
+  int blocks = wav.left.size() / length;
+  int oldLength = audioRing.length;
+  memset(timing, 0, sizeof(timing));
+  blockRingInit(audioRing, ringDepth);
+  blockRingSetRate(audioRing, wav.sampleRate); //already checked by main
+  blockRingSetLength(audioRing, length);
+  ddsBlockLength(oldLength, length);
+  paramCommit(audioParams);
+  blockRingRetimeRead(audioRing); //as if command 30 arrived before the first transfer
+  profileInit(wav.sampleRate, length);
+  if(slowdown > 0)
+  {
+    return simRealTime(wav, out, blocks, 1e9 * length / wav.sampleRate, slowdown);
+  }
+  for(int block = 0; block < blocks; block++) //offline: every block is processed as soon as it arrives
+  {
+    if(simUpdateEvery && block && (block % simUpdateEvery == 0))
+    {
+      simStoreFilters(simFilters);
+      paramCommit(audioParams);
+      pipelineInvalidate();
+    }
+    if(simSweepStep && simFilters.firTaps)
+    {
+      simSweep();
+    }
+    if(simGlideHz && (block == 1))
+    {
+      simGlide(simGlideHz, simGlideMs);
+    }
+    simDmaRead(wav, block);
+    blockRingRunWorker(audioRing, simProcessBlock);
+    simDmaWrite(out);
+  }
+  return blocks;
+}
+
+//gain of the configured chain at one frequency in dB, from a sine through it.
+//The first half of the run lets the filters settle.
+double simGain(double freq, long sampleRate, int ringDepth, int length)
+{
+  wavData sine, out;
+  sine.sampleRate = out.sampleRate = sampleRate;
+  sine.channels = out.channels = 2;
+  sine.left.resize(32 * I2S_DMA_BUF_LEN);
+  for(size_t i = 0; i < sine.left.size(); i++)
+  {
+    sine.left[i] = (short) lround(16384 * sin(2 * M_PI * freq * i / sampleRate));
+  }
+  sine.right = sine.left;
+  simRun(sine, out, ringDepth, length, 0);
+  double in = 0, power = 0;
+  for(size_t i = out.left.size() / 2; i < out.left.size(); i++)
+  {
+    in += (double) sine.left[i] * sine.left[i];
+    power += (double) out.left[i] * out.left[i];
+  }
+  return (power > 0) ? 10 * log10(power / in) : -200;
+}
+
+void simUsage()
+{
+  fprintf(stderr, "usage: shieldSim [-n blocks] [-r rate] [-f taps [-F taps] [-M factor]] [-P] [-N taps[,mu]] [-c taps] [-X] [-D] [-J] [-i order | -I order] [-S hz[,ms]] [-E bands[,on]] [-L] [-s points] [-d] [-z] [-v samples] [-m mode] [-o order] [-b samples | -B] [-u blocks] [-U words] [-w hz] [-q depth] [-t factor] [in.wav [out.wav]]\n");
+}
+
+int main(int argc, char **argv)
+{
+  int blocks = 2000;
+  int firTaps = 0, firTapsRight = 0, iirOrder = 0, iirMode = LOW_PASS, fftPoints = 0, reverbDelay = 0, mathMode = MATH_NONE;
+  int ringDepth = BLOCK_RING_SIZE;
+  int blockLength = I2S_DMA_BUF_LEN;
+  int uploadChunk = 0;
+  int firFactor = 1, nlmsTaps = 0, nlmsMu = FIR_NLMS_MU_DEFAULT;
+  int eqBands = 0, eqOn = 0;
+  bool printLog = false;
+  bool benchmark = false, firBenchmark = false, designBenchmark = false, iirDesignBenchmark = false, multirateBenchmark = false;
+  int order[PIPE_STAGE_KINDS], orderCount = 0;
+  double slowdown = 0;
+  bool dds = false, noise = false;
+  wavData wav;
+  wav.sampleRate = 44100;
+  wav.channels = 2;
+
+  int opt;
+  while((opt = getopt(argc, argv, "n:r:f:F:M:PN:c:XDJi:I:S:E:Ls:dzv:m:o:b:Bu:U:w:q:t:h")) != -1)
+  {
+    switch(opt)
+    {
+      case 'n': blocks = atoi(optarg); break;
+      case 'r': wav.sampleRate = atol(optarg); break;
+      case 'f': firTaps = atoi(optarg); break;
+      case 'F': firTapsRight = atoi(optarg); break;
+      case 'M': firFactor = atoi(optarg); break;
+      case 'P': multirateBenchmark = true; break;
+      case 'N':
+        nlmsTaps = atoi(strtok(optarg, ","));
+        if(char *mu = strtok(0, ","))
+        {
+          nlmsMu = atoi(mu);
+        }
+        break;
+      case 'c': firFftCrossover = atoi(optarg); break;
+      case 'X': firBenchmark = true; break;
+      case 'D': designBenchmark = true; break;
+      case 'J': iirDesignBenchmark = true; break;
+      case 'i': iirOrder = atoi(optarg); iirMode = LOW_PASS; break;
+      case 'I': iirOrder = atoi(optarg); iirMode = BAND_STOP; break;
+      case 'S':
+        simGlideHz = atoi(strtok(optarg, ","));
+        if(char *ms = strtok(0, ","))
+        {
+          simGlideMs = atoi(ms);
+        }
+        break;
+      case 'L': printLog = true; break;
+      case 'E':
+        eqBands = eqOn = atoi(strtok(optarg, ","));
+        if(char *on = strtok(0, ","))
+        {
+          eqOn = atoi(on);
+        }
+        break;
+      case 's': fftPoints = atoi(optarg); break;
+      case 'd': dds = true; break;
+      case 'z': noise = true; break;
+      case 'v': reverbDelay = atoi(optarg); break;
+      case 'm': mathMode = atoi(optarg); break;
+      case 'o':
+        for(char *kind = strtok(optarg, ","); kind && (orderCount < PIPE_STAGE_KINDS); kind = strtok(0, ","))
+        {
+          order[orderCount++] = atoi(kind);
+        }
+        break;
+      case 'b': blockLength = atoi(optarg); break;
+      case 'B': benchmark = true; break;
+      case 'u': simUpdateEvery = atoi(optarg); break;
+      case 'U': uploadChunk = atoi(optarg); break;
+      case 'w': simSweepStep = atol(optarg); break;
+      case 'q': ringDepth = atoi(optarg); break;
+      case 't': slowdown = atof(optarg); break;
+      default: simUsage(); return 1;
+    }
+  }
+  if((firFactor != 1) && (!firMultirateValid(firFactor) || (firTaps > FILTER_LENGTH_MAX)))
+  {
+    fprintf(stderr, "multirate factor 2, 4 or 8, with up to %d taps\n", FILTER_LENGTH_MAX);
+    return 1;
+  }
+  if((firTaps > FIR_FFT_TAPS_MAX) || (firTapsRight > FIR_FFT_TAPS_MAX) || (iirOrder > IIR_ORDER_MAX) || (iirOrder % 2) || (fftPoints > WINDOW_LENGTH) || !blockRingSetLength(audioRing, blockLength))
+  {
+    fprintf(stderr, "fir taps <= %d, iir order even and <= %d, spectrum points <= %d, block length a power of two from %d to %d\n",
+            FIR_FFT_TAPS_MAX, IIR_ORDER_MAX, WINDOW_LENGTH, BLOCK_LEN_MIN, I2S_DMA_BUF_LEN);
+    return 1;
+  }
+
+  if(optind < argc)
+  {
+    if(!wavRead(argv[optind], wav))
+    {
+      fprintf(stderr, "could not read 16 bit PCM wav %s\n", argv[optind]);
+      return 1;
+    }
+  }
+  else
+  {
+    wav.left.resize((size_t) blocks * I2S_DMA_BUF_LEN);
+    wav.right.resize(wav.left.size());
+    for(size_t i = 0; i < wav.left.size(); i++)
+    {
+      wav.left[i] = (short)(rand() % 16384 - 8192);
+      wav.right[i] = (short)(rand() % 16384 - 8192);
+    }
+  }
+
+  if(designBenchmark)
+  {
+    const int lengths[] = {41, 101, 201, 511, 1023, 2047, 4095};
+    const int windows[] = {FIR_WINDOW_BLACKMAN, 80};
+    const char *types[] = {"", "low", "high", "band", "stop"};
+    std::vector<int> coeffs(FIR_FFT_TAPS_MAX);
+    std::vector<double> exact;
+    printf("%-8s %-10s %-6s %14s %12s\n", "taps", "window", "type", "us/design", "max error");
+    for(unsigned int i = 0; i < sizeof(lengths)/sizeof(lengths[0]); i++)
+    {
+      for(unsigned int w = 0; w < sizeof(windows)/sizeof(windows[0]); w++)
+      {
+        for(int type = LOW_PASS; type <= BAND_STOP; type++)
+        {
+          long f1 = 1000, f2 = 4000;
+          int repeats = 0;
+          std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+          double elapsed;
+          do
+          {
+            firDesign(&coeffs[0], lengths[i], type, f1, f2, wav.sampleRate, windows[w]);
+            repeats++;
+            elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+          } while(elapsed < 20000);
+          simDesignDouble(exact, lengths[i], type, f1, f2, wav.sampleRate, windows[w]);
+          double worst = 0;
+          for(int k = 0; k < lengths[i]; k++)
+          {
+            worst = std::max(worst, fabs(coeffs[k] - exact[k]));
+          }
+          char window[16];
+          snprintf(window, sizeof(window), windows[w] ? "kaiser %d" : "blackman", windows[w]);
+          printf("%-8d %-10s %-6s %14.1f %12.2f\n", lengths[i], window, types[type], elapsed / repeats, worst);
+        }
+      }
+    }
+    return 0;
+  }
+
+  if(iirDesignBenchmark)
+  {
+    const int orders[] = {2, 4, 8, 12, 16, 20, 30, 40};
+    const char *responses[] = {"butter", "bessel", "ellip", "cheby"};
+    const char *passes[] = {"", "low", "high"};
+    long hz = 1000;
+    int coeffs[COEFFS_PER_BIQUAD*IIR_ORDER_MAX/2];
+    printf("%-8s %-8s %-6s %14s %14s\n", "order", "response", "pass", "us/design", "max error dB");
+    for(unsigned int i = 0; i < sizeof(orders)/sizeof(orders[0]); i++)
+    {
+      for(int type = TYPE_BUTTER; type <= TYPE_CHEBY; type++)
+      {
+        for(int pass = LOW_PASS; pass <= HIGH_PASS; pass++)
+        {
+          int repeats = 0, designed;
+          std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+          double elapsed;
+          do
+          {
+            designed = iirDesign(coeffs, orders[i], type, pass, hz, wav.sampleRate);
+            repeats++;
+            elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+          } while(elapsed < 20000);
+          if(!designed)
+          {
+            int refused = (type == TYPE_ELLIP) && (orders[i] > IIR_ELLIP_ORDER_MAX);
+            printf("%-8d %-8s %-6s %14.1f %14s\n", orders[i], responses[type], passes[pass], elapsed / repeats, refused ? "refused" : "unstable");
+            continue;
+          }
+          //over the log spaced band down to 60 dB below the pass band, past that rounding noise is all there is
+          double worst = 0;
+          for(double f = 20; f < wav.sampleRate / 2; f *= 1.02)
+          {
+            double exact = simIirExactDb(type, pass, orders[i], f, hz, wav.sampleRate);
+            if(exact > -IIR_STOP_DB)
+            {
+              worst = std::max(worst, fabs(simBiquadDb(coeffs, orders[i], f, wav.sampleRate) - exact));
+            }
+          }
+          printf("%-8d %-8s %-6s %14.1f %14.2f\n", orders[i], responses[type], passes[pass], elapsed / repeats, worst);
+        }
+      }
+    }
+    return 0;
+  }
+
+  //bring the modules up the way setup() does.
+  logInit();
+  AudioC.Audio(TRUE);
+  blockRingInit(audioRing, ringDepth);
+  if(!blockRingSetRate(audioRing, wav.sampleRate))
+  {
+    fprintf(stderr, "%ld Hz is not a codec sampling rate\n", wav.sampleRate);
+    return 1;
+  }
+  firSymmetricCalibrate(delayBufferL[0], delayBufferL[1], delayBufferR[0]); //as setup does, on the host's kernels
+  fillShortBuf(delayBufferL[0], 0, 2*FIR_DELAY_LEN);
+  fillShortBuf(delayBufferR[0], 0, 2*FIR_DELAY_LEN);
+  paramInit(audioParams);
+  reverbL.init(0, 0, 0);
+  reverbR.init(0, 0, 0);
+  fftConfigLeft = FFTInit();
+  fftConfigRight = FFTInit();
+  pipelineSources sources;
+  sources.params = &audioParams;
+  sources.reverb[0] = &reverbL;
+  sources.reverb[1] = &reverbR;
+  sources.firDelay[0][0] = delayBufferL[0];
+  sources.firDelay[0][1] = delayBufferL[1];
+  sources.firDelay[1][0] = delayBufferR[0];
+  sources.firDelay[1][1] = delayBufferR[1];
+  sources.firFft[0] = &firFftLeft;
+  sources.firFft[1] = &firFftRight;
+  sources.firMultirate[0][0] = &firMultirateLeft[0];
+  sources.firMultirate[0][1] = &firMultirateLeft[1];
+  sources.firMultirate[1][0] = &firMultirateRight[0];
+  sources.firMultirate[1][1] = &firMultirateRight[1];
+  sources.nlms = &firNlmsLeft;
+  sources.sweep[0] = &iirSweepLeft;
+  sources.sweep[1] = &iirSweepRight;
+  sources.eq[0] = &eqStateLeft;
+  sources.eq[1] = &eqStateRight;
+  sources.fft[0] = &fftConfigLeft;
+  sources.fft[1] = &fftConfigRight;
+  pipelineInit(audioPipeline, sources);
+
+  //then apply the requested configuration, as the mailbox commands would.
+  stageParams &params = paramEdit(audioParams);
+  if(dds)
+  {
+    for(int i = 0; i < DDS_LENGTH; i++)
+    {
+      phase_to_amplitude_l[i] = (int) lround(32767 * sin(2 * M_PI * i / DDS_LENGTH));
+    }
+    params.dds[CHAN_LEFT] = ddsInit(10, 1000, 1000, 0.5, 0, 0, MUX_SUM, WAV_SIN);
+    params.dds[CHAN_RIGHT] = params.dds[CHAN_LEFT];
+    params.ddsRestart[CHAN_LEFT] = params.ddsRestart[CHAN_RIGHT] = 1;
+  }
+  if(noise)
+  {
+    params.noise[CHAN_LEFT] = noiseInit(0.1, MUX_SUM);
+    params.noise[CHAN_RIGHT] = params.noise[CHAN_LEFT];
+  }
+  mathChannelMode(params.math, CHAN_BOTH, mathMode);
+  params.nlms.taps = (nlmsTaps > FIR_NLMS_TAPS_MAX) ? FIR_NLMS_TAPS_MAX : nlmsTaps;
+  params.nlms.mu = nlmsMu;
+  params.reverbDelay[CHAN_LEFT] = params.reverbDelay[CHAN_RIGHT] = (reverbDelay > MAX_DELAY) ? MAX_DELAY : reverbDelay;
+  simFilters.firTaps = firTaps;
+  simFilters.firTapsRight = firTapsRight;
+  simFilters.firFactor = firFactor;
+  simFilters.firCutoff = 1000;
+  simFilters.uploadChunk = (uploadChunk > 0) ? std::min(uploadChunk, MAILBOX_SIZE/2 - 3) : 0;
+  simFilters.iirOrder = iirOrder;
+  simFilters.iirMode = iirMode;
+  simFilters.sampleRate = wav.sampleRate;
+  simStoreFilters(simFilters);
+  if(simGlideHz)
+  {
+    simGlide(200, 0);
+    paramEdit(audioParams);
+  }
+  simEq(eqBands, eqOn, wav.sampleRate);
+  if(fftPoints)
+  {
+    fftConfigLeft = configFFT(1, 0, SOURCE_OUTPUT, CHAN_LEFT, SPECTRUM_MAGNITUDE, WINDOW_BLACKMAN, fftPoints);
+    fftConfigRight = configFFT(1, 0, SOURCE_OUTPUT, CHAN_RIGHT, SPECTRUM_MAGNITUDE, WINDOW_BLACKMAN, fftPoints);
+  }
+
+  if(orderCount)
+  {
+    pipelineSetOrder(paramEdit(audioParams), order, orderCount);
+  }
+  paramCommit(audioParams);
+  pipelineInvalidate(); //as readFilter does after a spectrum command
+
+  wavData out;
+  out.sampleRate = wav.sampleRate;
+  out.channels = 2;
+
+  if(multirateBenchmark)
+  {
+    //the same 300 Hz low pass and transition width at every factor, odd lengths run by filter_fir.
+    const int factors[] = {1, 2, 4, 8};
+    printf("%-8s %8s %14s %14s %12s %14s\n", "factor", "taps", "mults/sample", "ns/block", "50 Hz dB", "stopband dB");
+    firFftCrossover = FIR_FFT_TAPS_MAX;
+    simFilters.firTapsRight = 0;
+    simFilters.firCutoff = 300;
+    for(unsigned int i = 0; i < sizeof(factors)/sizeof(factors[0]); i++)
+    {
+      int factor = factors[i];
+      simFilters.firFactor = factor;
+      simFilters.firTaps = (FILTER_LENGTH_MAX / factor) | 1;
+      simStoreFilters(simFilters);
+      out.left.clear();
+      out.right.clear();
+      int blocks = simRun(wav, out, ringDepth, blockLength, 0);
+      double ns = timing[STAGE_FIR].nsTotal / blocks;
+      double mults = (double) simFilters.firTaps / factor;
+      if(factor > 1)
+      {
+        mults += 2.0 * (factor * FIR_MR_PHASE_TAPS + 1) / factor; //decimator and interpolator
+      }
+      double worst = -200;
+      for(double freq = 700; freq < wav.sampleRate / 2; freq *= 1.1) //from past the transition band to Nyquist
+      {
+        worst = std::max(worst, simGain(freq, wav.sampleRate, ringDepth, blockLength));
+      }
+      printf("%-8d %8d %14.1f %14.0f %12.2f %14.1f\n", factor, simFilters.firTaps, mults, ns, simGain(50, wav.sampleRate, ringDepth, blockLength), worst);
+    }
+    return 0;
+  }
+
+  if(firBenchmark)
+  {
+    //both engines where they overlap, then the lengths only the FFT engine can run.
+    const int lengths[] = {16, 32, 48, 64, 96, 128, 160, 192, 256, 320, 384, 448, 511, 1024, 2048, 4096};
+    int crossover = 0;
+    printf("%-8s %16s %16s\n", "taps", "time ns/block", "fft ns/block");
+    for(unsigned int i = 0; i < sizeof(lengths)/sizeof(lengths[0]); i++)
+    {
+      double ns[2] = {0, 0};
+      simFilters.firTaps = lengths[i];
+      for(int fft = 0; fft < 2; fft++)
+      {
+        if(!fft && (lengths[i] > FILTER_LENGTH_MAX))
+        {
+          continue;
+        }
+        firFftCrossover = fft ? 0 : FIR_FFT_TAPS_MAX;
+        simStoreFilters(simFilters);
+        out.left.clear();
+        out.right.clear();
+        int blocks = simRun(wav, out, ringDepth, blockLength, 0);
+        ns[fft] = timing[STAGE_FIR].nsTotal / blocks;
+      }
+      if(ns[0] > 0)
+      {
+        printf("%-8d %16.0f %16.0f\n", lengths[i], ns[0], ns[1]);
+        if(!crossover && (ns[1] < ns[0]))
+        {
+          crossover = (i > 0) ? lengths[i-1] : 0; //the longest length the time domain kernel still won
+        }
+      }
+      else
+      {
+        printf("%-8d %16s %16.0f\n", lengths[i], "-", ns[1]);
+      }
+    }
+    printf("symmetric: folded from %u taps even, %u taps odd\n", firSymmetricMin[0], firSymmetricMin[1]);
+    if(crossover)
+    {
+      printf("crossover: filters longer than %d taps are cheaper in the FFT engine\n", crossover);
+    }
+    else
+    {
+      printf("crossover: time domain wins up to %d taps\n", FILTER_LENGTH_MAX);
+    }
+    return 0;
+  }
+
+  if(benchmark)
+  {
+    printf("%-8s %8s %10s %14s %14s %14s %10s\n", "samples", "blocks", "block ms", "stages ns", "worker ns", "cycles/sample", "% budget");
+    for(int length = BLOCK_LEN_MIN; length <= I2S_DMA_BUF_LEN; length *= 2)
+    {
+      out.left.clear();
+      out.right.clear();
+      int blocks = simRun(wav, out, ringDepth, length, slowdown);
+      double budgetNs = 1e9 * length / wav.sampleRate;
+      double stagesNs = 0;
+      for(int s = 0; s < PIPE_STAGE_KINDS; s++)
+      {
+        stagesNs += timing[s].nsTotal / blocks;
+      }
+      double workerNs = timing[PIPE_STAGE_KINDS].nsTotal / blocks;
+      double cycles = timing[PIPE_STAGE_KINDS].cyclesTotal / blocks / length;
+      printf("%-8d %8d %10.2f %14.0f %14.0f %14.1f %10.2f\n", length, blocks, budgetNs / 1e6, stagesNs, workerNs, cycles, 100 * workerNs / budgetNs);
+    }
+    return 0;
+  }
+
+  blocks = simRun(wav, out, ringDepth, blockLength, slowdown);
+  double budgetNs = 1e9 * blockLength / wav.sampleRate;
+  double nsTotal = 0, nsMax = 0, cyclesTotal = 0;
+  printf("%d blocks of %d samples at %ld Hz, block budget %.0f ns\n", blocks, blockLength, wav.sampleRate, budgetNs);
+  printf("%-10s %14s %14s %14s %10s\n", "stage", "avg ns/block", "max ns/block", "cycles/sample", "% budget");
+  for(int s = 0; s < PIPE_STAGE_KINDS; s++)
+  {
+    double avg = blocks ? timing[s].nsTotal / blocks : 0;
+    double cycles = blocks ? timing[s].cyclesTotal / blocks / blockLength : 0;
+    printf("%-10s %14.0f %14.0f %14.1f %10.2f\n", stageNames[s], avg, timing[s].nsMax, cycles, 100 * avg / budgetNs);
+    nsTotal += avg;
+    nsMax += timing[s].nsMax;
+    cyclesTotal += cycles;
+  }
+  printf("%-10s %14.0f %14.0f %14.1f %10.2f\n", "total", nsTotal, nsMax, cyclesTotal, 100 * nsTotal / budgetNs);
+  stageTiming &worker = timing[PIPE_STAGE_KINDS];
+  double workerAvg = blocks ? worker.nsTotal / blocks : 0;
+  printf("%-10s %14.0f %14.0f %14.1f %10.2f\n", "worker", workerAvg, worker.nsMax, blocks ? worker.cyclesTotal / blocks / blockLength : 0, 100 * workerAvg / budgetNs);
+  if(printLog)
+  {
+    logRecord record;
+    while(logRead(record))
+    {
+      printf("log %u us level %d event %d:", (unsigned int) record.stamp, record.level, record.event);
+      for(int i = 0; i < LOG_ARGS; i++)
+      {
+        printf(" %d", record.args[i]);
+      }
+      printf("\n");
+    }
+  }
+
+  if(optind + 1 < argc)
+  {
+    if(!wavWrite(argv[optind + 1], out))
+    {
+      fprintf(stderr, "could not write %s\n", argv[optind + 1]);
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include <string.h>
+#include "wavFile.h"
+
+static unsigned long readLE(FILE *f, int bytes)
+{
+  unsigned long v = 0;
+  for(int i = 0; i < bytes; i++)
+  {
+    int c = fgetc(f);
+    if(c == EOF)
+      return 0;
+    v |= (unsigned long) c << (8*i);
+  }
+  return v;
+}
+
+static void writeLE(FILE *f, unsigned long v, int bytes)
+{
+  for(int i = 0; i < bytes; i++)
+  {
+    fputc((v >> (8*i)) & 0xFF, f);
+  }
+}
+
+bool wavRead(const char *path, wavData &wav)
+{
+  FILE *f = fopen(path, "rb");
+  if(!f)
+    return false;
+  char tag[4];
+  if((fread(tag, 1, 4, f) != 4) || memcmp(tag, "RIFF", 4))
+  {
+    fclose(f);
+    return false;
+  }
+  readLE(f, 4);
+  if((fread(tag, 1, 4, f) != 4) || memcmp(tag, "WAVE", 4))
+  {
+    fclose(f);
+    return false;
+  }
+  int bits = 0;
+  wav.channels = 0;
+  while(fread(tag, 1, 4, f) == 4) //walk the chunks until data
+  {
+    unsigned long size = readLE(f, 4);
+    if(!memcmp(tag, "fmt ", 4))
+    {
+      int format = readLE(f, 2);
+      wav.channels = readLE(f, 2);
+      wav.sampleRate = readLE(f, 4);
+      readLE(f, 6);
+      bits = readLE(f, 2);
+      fseek(f, size - 16, SEEK_CUR);
+      if((format != 1) || (bits != 16) || (wav.channels < 1))
+      {
+        fclose(f);
+        return false;
+      }
+    }
+    else if(!memcmp(tag, "data", 4) && wav.channels)
+    {
+      unsigned long frames = size / (2*wav.channels);
+      wav.left.resize(frames);
+      wav.right.resize(frames);
+      for(unsigned long i = 0; i < frames; i++)
+      {
+        wav.left[i] = (short) readLE(f, 2);
+        wav.right[i] = wav.left[i];
+        if(wav.channels > 1)
+          wav.right[i] = (short) readLE(f, 2);
+        for(int c = 2; c < wav.channels; c++) //drop anything past stereo
+          readLE(f, 2);
+      }
+      fclose(f);
+      return true;
+    }
+    else
+    {
+      fseek(f, size + (size & 1), SEEK_CUR);
+    }
+  }
+  fclose(f);
+  return false;
+}
+
+bool wavWrite(const char *path, const wavData &wav)
+{
+  FILE *f = fopen(path, "wb");
+  if(!f)
+    return false;
+  unsigned long frames = wav.left.size();
+  fwrite("RIFF", 1, 4, f);
+  writeLE(f, 36 + frames*4, 4);
+  fwrite("WAVEfmt ", 1, 8, f);
+  writeLE(f, 16, 4);
+  writeLE(f, 1, 2);
+  writeLE(f, 2, 2);
+  writeLE(f, wav.sampleRate, 4);
+  writeLE(f, wav.sampleRate*4, 4);
+  writeLE(f, 4, 2);
+  writeLE(f, 16, 2);
+  fwrite("data", 1, 4, f);
+  writeLE(f, frames*4, 4);
+  for(unsigned long i = 0; i < frames; i++)
+  {
+    writeLE(f, (unsigned short) wav.left[i], 2);
+    writeLE(f, (unsigned short) wav.right[i], 2);
+  }
+  fclose(f);
+  return true;
+}
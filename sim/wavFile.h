@@ -0,0 +1,18 @@
+//Minimal 16 bit PCM WAV reader/writer for the offline simulator.
+#ifndef _SIM_WAVFILE_H_INCLUDED
+#define _SIM_WAVFILE_H_INCLUDED
+
+#include <stdio.h>
+#include <vector>
+
+struct wavData {
+  long sampleRate;
+  int channels;
+  std::vector<short> left;
+  std::vector<short> right; //copy of left for mono files
+};
+
+bool wavRead(const char *path, wavData &wav); //returns false if the file is missing or not 16 bit PCM
+bool wavWrite(const char *path, const wavData &wav); //always writes stereo
+
+#endif
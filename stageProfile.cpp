@@ -0,0 +1,109 @@
+#include "stageProfile.h"
+
+stageProfile audioProfile;
+
+void profileInit(long sampleRate, int blockLen)
+{
+  audioProfile.blockPeriod = (unsigned int)(blockLen * 1000000.0 / sampleRate);
+  audioProfile.sendRequested = 0;
+  profileReset();
+}
+
+void profileReset()
+{
+  audioProfile.resetRequests = audioProfile.resetRequests + 1;
+}
+
+void profileClear()
+{
+  unsigned int requests = audioProfile.resetRequests;
+  for(int s = 0; s < STAGE_COUNT; s++)
+  {
+    stageStats &stats = audioProfile.stats[s];
+    memset(stats.history, 0, PROFILE_HISTORY);
+    memset(stats.histogram, 0, PROFILE_BINS);
+    stats.min = 0xFFFF;
+    stats.max = 0;
+    stats.sum = 0;
+    stats.count = 0;
+    stats.index = 0;
+  }
+  audioProfile.resetsDone = requests;
+}
+
+void profileRecord(int stage, unsigned int us)
+{
+  stageStats &stats = audioProfile.stats[stage];
+  int index = stats.index;
+
+  //the ring entry we overwrite drops out of the running sum.
+  stats.sum += us;
+  if(stats.count < PROFILE_HISTORY)
+  {
+    stats.count++;
+  }
+  else
+  {
+    stats.sum -= stats.history[index];
+  }
+  stats.history[index] = us;
+  stats.index = (index + 1) % PROFILE_HISTORY;
+
+  if(us < stats.min)
+  {
+    stats.min = us;
+  }
+  if(us > stats.max)
+  {
+    stats.max = us;
+  }
+
+  int bin = PROFILE_BINS - 1;
+  if(us < audioProfile.blockPeriod)
+  {
+    bin = ((unsigned long) us * (PROFILE_BINS - 1)) / audioProfile.blockPeriod;
+  }
+  if(stats.histogram[bin] != 0xFFFF) //saturate rather than wrap
+  {
+    stats.histogram[bin]++;
+  }
+}
+
+void profileRequest()
+{
+  audioProfile.sendRequested = 1;
+  if(((shieldMailbox.inbox[5]<<8) + shieldMailbox.inbox[4]) == 1) //reset after reading
+  {
+    audioProfile.sendRequested = 2;
+  }
+}
+
+void sendStageProfile()
+{
+  if(audioProfile.sendRequested == 0)
+  {
+    return;
+  }
+  //<block period us><PROFILE_TAG> then per stage <min><avg><max><PROFILE_BINS x count>, all in microseconds
+  int message[PROFILE_MESSAGE_LEN];
+  int n = 0;
+  message[n++] = audioProfile.blockPeriod;
+  message[n++] = PROFILE_TAG;
+  for(int s = 0; s < STAGE_COUNT; s++)
+  {
+    stageStats &stats = audioProfile.stats[s];
+    message[n++] = stats.count ? stats.min : 0;
+    message[n++] = stats.count ? (unsigned int)(stats.sum / stats.count) : 0;
+    message[n++] = stats.max;
+    for(int b = 0; b < PROFILE_BINS; b++)
+    {
+      message[n++] = stats.histogram[b];
+    }
+  }
+  shieldMailbox.transmit(message, n);
+  if(audioProfile.sendRequested == 2)
+  {
+    profileReset();
+  }
+  audioProfile.sendRequested = 0;
+}
@@ -0,0 +1,73 @@
+//Per-stage timing of the audio processing chain.
+//Each stage is stamped with micros() as it finishes. The last PROFILE_HISTORY
+//samples of every stage are kept in a fixed ring for the average, alongside
+//min/max and a histogram in tenths of the block period. Stages left out of the
+//pipeline are not recorded.
+#ifndef _STAGEPROFILE_H_INCLUDED	//prevent profile library from being invoked twice and breaking the namespace
+#define _STAGEPROFILE_H_INCLUDED
+
+#include "core.h"
+#include "Audio_exposed.h"
+#include "mailbox.h"
+
+#define STAGE_PROFILING 1 //comment out to compile the probes away
+
+#define STAGE_DDS 0
+#define STAGE_NOISE 1
+#define STAGE_MATH 2
+#define STAGE_REVERB 3
+#define STAGE_IIR 4
+#define STAGE_FIR 5
+#define STAGE_SPECTRUM 6
+#define STAGE_BLOCK 7 //the whole block, start to finish
+#define STAGE_COUNT 8
+
+#define PROFILE_HISTORY 32
+#define PROFILE_BINS 11 //10% slices of the block period, last bin is an overrun
+#define PROFILE_TAG (-384) //second word of a profile message, spectra use -128 and -256
+#define PROFILE_MESSAGE_LEN (2 + STAGE_COUNT*(3 + PROFILE_BINS))
+
+struct stageStats {
+  unsigned int history[PROFILE_HISTORY]; //microseconds
+  unsigned int min;
+  unsigned int max;
+  unsigned int histogram[PROFILE_BINS];
+  unsigned long sum; //of the history ring
+  unsigned int count; //valid entries in the history ring
+  int index; //next history entry to overwrite
+};
+
+struct stageProfile {
+  stageStats stats[STAGE_COUNT];
+  unsigned int blockPeriod; //microseconds
+  unsigned long blockStart;
+  unsigned long stamp;
+  int sendRequested;
+  volatile unsigned int resetRequests; //loop()
+  unsigned int resetsDone; //worker, the statistics are its own
+};
+
+void profileInit(long sampleRate, int blockLen); //sets the block period and asks for a reset
+void profileReset(); //loop() side, the worker clears the statistics at the start of its next block
+void profileClear(); //worker side, carries out the resets asked for
+
+void profileRecord(int stage, unsigned int us); //adds one sample to a stage
+void profileRequest(); //mailbox command, queues a readback for loop()
+void sendStageProfile(); //sends the statistics if requested. Call from loop()
+
+extern stageProfile audioProfile;
+
+#ifdef STAGE_PROFILING
+//stamp the start of a block, after any reset loop() asked for
+#define profileBlockStart() do { if(audioProfile.resetRequests != audioProfile.resetsDone) profileClear(); audioProfile.blockStart = audioProfile.stamp = micros(); } while(0)
+//charge the time since the previous stamp to stage
+#define profileStage(stage) do { unsigned long now = micros(); profileRecord((stage), now - audioProfile.stamp); audioProfile.stamp = now; } while(0)
+//charge the whole block
+#define profileBlockEnd() do { audioProfile.stamp = micros(); profileRecord(STAGE_BLOCK, audioProfile.stamp - audioProfile.blockStart); } while(0)
+#else
+#define profileBlockStart()
+#define profileStage(stage)
+#define profileBlockEnd()
+#endif
+
+#endif